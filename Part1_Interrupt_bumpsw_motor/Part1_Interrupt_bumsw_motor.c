@@ -32,13 +32,14 @@ policies, either expressed or implied, of the FreeBSD Project.
 #include <stdint.h>
 #include "msp.h"
 
-// Check if you need to include these libraries
-/*
 #include "../inc/Clock.h"
 #include "../inc/SysTick.h"
 #include "../inc/CortexM.h"
 #include "../inc/motor.h"
-*/
+#include "../inc/Motion.h"
+#include "../inc/BumpFifo.h"
+#include "../inc/Debounce.h"
+#include "../inc/LowPower.h"
 
 // Color    LED(s) Port2
 // dark     ---    0
@@ -71,209 +72,187 @@ void BumpEdgeTrigger_Init(void){
     P4->IES |= 0xED;        // falling edge event
     P4->IFG &= ~0xED;       // clear flag
     P4->IE |= 0xED;         // arm the interrupt
-    // priority 2 on port4
-    NVIC->IP[9] = (NVIC->IP[9]&0xFF00FFFF)|0x00400000;
+    // priority 2 on port4 (IP is byte wide, one entry per interrupt)
+    NVIC->IP[38] = 0x40;
     // enable interrupt 38 in NVIC on port4
     NVIC->ISER[1] = 0x00000040;
 }
 
-// Uses P4IV IRQ handler to solve critical section/race
-void PORT4_IRQHandler(void){
-
-    uint8_t status;
-
-    // The movement for coloured LED
-    // WHITE:   Forward
-    // BLUE:    Turn right
-    // YELLOW:  Turn left
-    // GREEN:   Backward
-    Port2_Output(0);        // turn off the coloured LED
-
-    // Interrupt Vector of Port4
-      status = P4->IV;      // 2*(n+1) where n is highest priority
+// Initialize Bump sensors for the debouncer (no edge interrupt)
+// Make six from Port 4 input pins
+// Activate interface pull-up
+// The pins are P4.7, 4.6, 4.5, 4.3, 4.2, 4.0
+void Bump_Init(void){
+    P4->SEL0 &= ~0xED;
+    P4->SEL1 &= ~0xED;      // configure as GPIO
+    P4->DIR &= ~0xED;       // make in
+    P4->REN |= 0xED;        // enable pull resistors
+    P4->OUT |= 0xED;        // pull-up
+    P4->IE &= ~0xED;        // no interrupts, the switches are sampled by Timer A2
+}
 
-	  // The case used are the interrupt vector of P4->IV
-	  // For example, the bump switch 3 is connected to P4.3
-	  // (in other words, Port 4 at pin 3),
-	  // thus the status of case would be:
-	  // status = 2*(pin number + 1)
-	  //        = 2*(pin_3 + 1)
-	  //        = 2*(3 + 1)
-	  //        = 2*(4)
-	  //        = 8
-	  // in hex = 0x08
-	  // (*NOTE: in this code only bump switch 3 has been calculated,
-	  //         please figure out the other bump switches)
-      switch(status){
+// Called by the debouncer when switches change (negative logic, see Debounce.c)
+// Every newly pressed switch is recorded like a P4->IV interrupt would be,
+// 2*(pin number + 1), lowest pin first
+void Bump_Edge(uint8_t pressed, uint8_t released){
+    uint8_t pin;
+    for(pin=0; pin<8; pin++){
+        if(pressed&(1<<pin)){
+            BumpFifo_Put(2*(pin+1));
+        }
+    }
+}
 
-        case 0x00: // Bump switch 1
-		
-            // Change the coloured LED into green (backward)
-			
-            // Move backward at 500 duty for 200ms
-            
-			// turn off the coloured LED
-            
-            // Stop for 1000ms
-            
-			// Change the coloured LED into yellow (turn left)
-            
-            // Make a left turn at 500 duty for 100ms
-            
-			// turn off the coloured LED
-            
-            // Stop for 1000ms
-            
-          break;
-        case 0x00: // Bump switch 2
-		
-            // Change the coloured LED into green (backward)
-			
-            // Move backward at 500 duty for 200ms
-            
-			// turn off the coloured LED
-            
-            // Stop for 1000ms
-            
-			// Change the coloured LED into yellow (turn left)
-            
-            // Make a left turn at 500 duty for 200ms
-            
-			// turn off the coloured LED
-            
-            // Stop for 1000ms
-			
-          break;
-        case 0x08: // Bump switch 3
+// Reactions to the bump switches, run by the motion engine (Motion.c)
+// Each one backs off, stops, turns away from the obstacle and stops again
+// The movement for coloured LED
+// WHITE:   Forward
+// BLUE:    Turn right
+// YELLOW:  Turn left
+// GREEN:   Backward
+static const MotionSegment_t Bump1Script[4] = {
+  {MOTOR_BACKWARD, 500, GREEN,  200},  // Move backward at 500 duty for 200ms
+  {MOTOR_FORWARD,  0,   0,      1000}, // Stop for 1000ms
+  {MOTOR_LEFT,     500, YELLOW, 100},  // Make a left turn at 500 duty for 100ms
+  {MOTOR_FORWARD,  0,   0,      1000}  // Stop for 1000ms
+};
+static const MotionSegment_t Bump2Script[4] = {
+  {MOTOR_BACKWARD, 500, GREEN,  200},
+  {MOTOR_FORWARD,  0,   0,      1000},
+  {MOTOR_LEFT,     500, YELLOW, 200},  // Make a left turn at 500 duty for 200ms
+  {MOTOR_FORWARD,  0,   0,      1000}
+};
+static const MotionSegment_t Bump3Script[4] = {
+  {MOTOR_BACKWARD, 500, GREEN,  200},
+  {MOTOR_FORWARD,  0,   0,      1000},
+  {MOTOR_LEFT,     500, YELLOW, 300},  // Make a left turn at 500 duty for 300ms
+  {MOTOR_FORWARD,  0,   0,      1000}
+};
+static const MotionSegment_t Bump4Script[4] = {
+  {MOTOR_BACKWARD, 500, GREEN,  200},
+  {MOTOR_FORWARD,  0,   0,      1000},
+  {MOTOR_RIGHT,    500, BLUE,   300},  // Make a right turn at 500 duty for 300ms
+  {MOTOR_FORWARD,  0,   0,      1000}
+};
+static const MotionSegment_t Bump5Script[4] = {
+  {MOTOR_BACKWARD, 500, GREEN,  200},
+  {MOTOR_FORWARD,  0,   0,      1000},
+  {MOTOR_RIGHT,    500, BLUE,   200},  // Make a right turn at 500 duty for 200ms
+  {MOTOR_FORWARD,  0,   0,      1000}
+};
+static const MotionSegment_t Bump6Script[4] = {
+  {MOTOR_BACKWARD, 500, GREEN,  200},
+  {MOTOR_FORWARD,  0,   0,      1000},
+  {MOTOR_RIGHT,    500, BLUE,   100},  // Make a right turn at 500 duty for 100ms
+  {MOTOR_FORWARD,  0,   0,      1000}
+};
+static const MotionSegment_t HeadOnScript[4] = {
+  {MOTOR_BACKWARD, 500, GREEN,  400},  // Move backward at 500 duty for 400ms
+  {MOTOR_FORWARD,  0,   0,      1000},
+  {MOTOR_RIGHT,    500, BLUE,   600},  // Turn around at 500 duty for 600ms
+  {MOTOR_FORWARD,  0,   0,      1000}
+};
+
+// All the reactions, index 0 is no reaction
+#define NO_REACTION     0
+#define BUMP1_REACTION  1
+#define BUMP2_REACTION  2
+#define BUMP3_REACTION  3
+#define BUMP4_REACTION  4
+#define BUMP5_REACTION  5
+#define BUMP6_REACTION  6
+#define HEADON_REACTION 7
+static const MotionScript_t BumpScripts[8] = {
+  {0, 0},
+  {Bump1Script, 4},
+  {Bump2Script, 4},
+  {Bump3Script, 4},
+  {Bump4Script, 4},
+  {Bump5Script, 4},
+  {Bump6Script, 4},
+  {HeadOnScript, 4}
+};
+
+// Reaction for a 6-bit bump pattern, see Bump_Pattern()
+// Bits 2-0 (Bump3-Bump1) are on the right, bits 5-3 (Bump6-Bump4) on the left.
+// A hit on one side turns away from it, the switch closest to the centre
+// decides how far.  Hits on both sides at once are treated as head-on.
+#define BUMP_RIGHT(p)   ((p)&0x07)
+#define BUMP_LEFT(p)    (((p)>>3)&0x07)
+#define BUMP_REACTION(p) \
+  (((p)==0)                          ? NO_REACTION     : \
+   (BUMP_RIGHT(p) && BUMP_LEFT(p))   ? HEADON_REACTION : \
+   (BUMP_RIGHT(p)&0x04)              ? BUMP3_REACTION  : \
+   (BUMP_RIGHT(p)&0x02)              ? BUMP2_REACTION  : \
+   (BUMP_RIGHT(p)&0x01)              ? BUMP1_REACTION  : \
+   (BUMP_LEFT(p)&0x01)               ? BUMP4_REACTION  : \
+   (BUMP_LEFT(p)&0x02)               ? BUMP5_REACTION  : \
+                                       BUMP6_REACTION)
+#define BUMP_ROW(p) \
+  BUMP_REACTION((p)+0), BUMP_REACTION((p)+1), BUMP_REACTION((p)+2), BUMP_REACTION((p)+3), \
+  BUMP_REACTION((p)+4), BUMP_REACTION((p)+5), BUMP_REACTION((p)+6), BUMP_REACTION((p)+7)
+
+// Generated by the compiler, 64 bytes in flash
+static const uint8_t BumpTable[64] = {
+  BUMP_ROW(0),  BUMP_ROW(8),  BUMP_ROW(16), BUMP_ROW(24),
+  BUMP_ROW(32), BUMP_ROW(40), BUMP_ROW(48), BUMP_ROW(56)
+};
 
-            // Change the coloured LED into green (backward)
-			
-            // Move backward at 500 duty for 200ms
-            
-			// turn off the coloured LED
-            
-            // Stop for 1000ms
-            
-			// Change the coloured LED into yellow (turn left)
-            
-            // Make a left turn at 500 duty for 300ms
-            
-			// turn off the coloured LED
-            
-            // Stop for 1000ms
-			
-          break;
-        case 0x00: // Bump switch 4
-		
-            // Change the coloured LED into green (backward)
-			
-            // Move backward at 500 duty for 200ms
-            
-			// turn off the coloured LED
-            
-            // Stop for 1000ms
-            
-			// Change the coloured LED into blue (turn right)
-            
-            // Make a left turn at 500 duty for 300ms
-            
-			// turn off the coloured LED
-            
-            // Stop for 1000ms
-			
-          break;
-        case 0x00: // Bump switch 5
-		
-            // Change the coloured LED into green (backward)
-			
-            // Move backward at 500 duty for 200ms
-            
-			// turn off the coloured LED
-            
-            // Stop for 1000ms
-            
-			// Change the coloured LED into blue (turn right)
-            
-            // Make a left turn at 500 duty for 200ms
-            
-			// turn off the coloured LED
-            
-            // Stop for 1000ms
-			
-          break;
-        case 0x00: // Bump switch 6
+// Uses P4IV IRQ handler to solve critical section/race
+// The handler only reads P4->IV and records the events with a time stamp
+// (see BumpFifo.c), the reactions run in the main loop
+void PORT4_IRQHandler(void){
+    BumpFifo_Isr();
+}
 
-            // Change the coloured LED into green (backward)
-			
-            // Move backward at 500 duty for 200ms
-            
-			// turn off the coloured LED
-            
-            // Stop for 1000ms
-            
-			// Change the coloured LED into blue (turn right)
-            
-            // Make a left turn at 500 duty for 100ms
-            
-			// turn off the coloured LED
-            
-            // Stop for 1000ms
-			
-          break;
+// Convert P4 inputs (negative logic, P4.7, 4.6, 4.5, 4.3, 4.2, 4.0)
+// to a 6-bit positive logic result (0 to 63)
+// bit 5 Bump6 (P4.7)
+// bit 4 Bump5 (P4.6)
+// bit 3 Bump4 (P4.5)
+// bit 2 Bump3 (P4.3)
+// bit 1 Bump2 (P4.2)
+// bit 0 Bump1 (P4.0)
+uint8_t Bump_Pattern(uint8_t in){
+    in = ~in;
+    return (in&0x01)|((in&0x0C)>>1)|((in&0xE0)>>2);
+}
 
-        case 0xED: // none of the switches are pressed
-          break;
-      }
+// Convert an interrupt vector of P4->IV to the 6-bit pattern of its switch
+// For example, the bump switch 3 is connected to P4.3
+// (in other words, Port 4 at pin 3),
+// thus the vector would be:
+// status = 2*(pin number + 1)
+//        = 2*(pin_3 + 1)
+//        = 2*(3 + 1)
+//        = 2*(4)
+//        = 8
+// in hex = 0x08
+uint8_t Bump_VectorPattern(uint8_t vector){
+    if((vector < 0x02)||(vector > 0x10)) return 0;
+    return Bump_Pattern(~(1<<(vector/2-1)));
+}
 
-      P4->IFG &= ~0xED; // clear flag
+// Start the reaction for a 6-bit bump pattern, one table lookup
+// The reaction is handed to the motion engine and the function returns
+// right away, a new bump replaces the reaction that is still running
+void Bump_Reaction(uint8_t pattern){
+    const MotionScript_t *script = &BumpScripts[BumpTable[pattern&0x3F]];
+    if(script->n){
+        Motion_Replace(script->segment, script->n);
+    }
 }
 
 // Read current state of 6 switches
-// Returns a 6-bit positive logic result (0 to 63)
-// bit 5 Bump5
-// bit 4 Bump4
-// bit 3 Bump3
-// bit 2 Bump2
-// bit 1 Bump1
-// bit 0 Bump0
+// Returns the raw P4 inputs, negative logic, see Bump_Pattern()
 uint8_t Bump_Read_Input(void){
   return (P4->IN&0xED); // read P4.7, 4.6, 4.5, 4.3, 4.2, 4.0 inputs
 }
 
+// status is the raw P4 inputs from Bump_Read_Input, e.g. 0x6D is P4.7 pressed
 void checkbumpswitch(uint8_t status)
 {
-    switch(status){
-      //case 0x02: // Bump switch 1 (for interrupt vector)
-        case 0x6D: // Bump 1
-          Motor_BackwardSimple(500, 100); 	// Move backward at 500 duty for 200ms
-          Motor_StopSimple(100);			// Stop for 1000ms
-          Motor_LeftSimple(500, 50);		// Make a left turn at 500 duty for 100ms
-          Motor_StopSimple(100);			// Stop for 1000ms
-        break;
-      //case 0x06: // Bump switch 2 (for interrupt vector)
-        case 0xAD: // Bump 2
-
-        break;
-      //case 0x08: // Bump switch 3 (for interrupt vector)
-        case 0xCD: // Bump 3
-
-        break;
-      //case 0x0C: // Bump switch 4 (for interrupt vector)
-        case 0xE5: // Bump 4
-
-        break;
-      //case 0x0E: // Bump switch 5 (for interrupt vector)
-        case 0xE9: // Bump 5
-
-        break;
-      //case 0x10: // Bump switch 6 (for interrupt vector)
-        case 0xEC: // Bump 6
-
-        break;
-      case 0xED: // neither switch pressed
-
-        break;
-    }
+    Bump_Reaction(Bump_Pattern(status));
 }
 
 void Port1_Init(void){
@@ -283,12 +262,12 @@ void Port1_Init(void){
 }
 
 void Port2_Init(void){
-    P2->SEL0 &= ~0xC7;
-    P2->SEL1 &= ~0xC7;        // configure P2.2 P2.1 P2.0, and P2.6 P2.7 as GPIO
+    P2->SEL0 &= ~0x07;
+    P2->SEL1 &= ~0x07;        // configure P2.2 P2.1 P2.0 as GPIO
     P2->DIR |= 0x07;          // make P2.2-P2.0 out
     P2->DS |= 0x07;           // activate increased drive strength
     P2->OUT &= ~0x07;         // all LEDs off
-    P2->DIR |= 0xC0;          // Direction of the motor
+                              // P2.6 P2.7 are the motor PWM, see PWM.c
 }
 
 void Port2_Output(uint8_t data){
@@ -315,45 +294,61 @@ void Switch_Init(void){
 
 int main(void){
     uint8_t status;
+    BumpEvent_t event;
 
   Clock_Init48MHz();        // Initialise clock with 48MHz frequency
   Switch_Init();            // Initialise switches
   SysTick_Init();           // Initialise SysTick timer
   Port1_Init();             // Initialise P1.1 and P1.4 built-in buttons
   while(!SW2IN){            // Wait for SW2 switch
-      SysTick_Wait10ms(10); // Wait here for every 100ms
+      SysTick_Wait10ms(10); // Wait here for every 100ms (sleeping, see TimeBase.c)
       REDLED = !REDLED;     // The red LED is blinking waiting for command
   }
   REDLED = 0;               // Turn off the red LED
-  BumpEdgeTrigger_Init();   // Initialise bump switches using edge interrupt
 
   Port2_Init();             // Initialise P2.2-P2.0 built-in LEDs
   Port2_Output(WHITE);      // White is the colour to represent moving forward
-  Motor_InitSimple();       // Initialise DC Motor
-  Motor_StopSimple(100);    // Stop the motor on initial state
-
+  Motion_Init(&Port2_Output); // Initialise DC Motor, PWM and motion engine (motor stopped)
+  BumpFifo_Init(0);         // Bump events are polled by the main loop
+  Bump_Init();              // Initialise bump switches
+  // Debounce the bump switches: sample every 1ms, 5 equal samples in a row
+  // (about 5ms) to accept a press or release, no edge interrupts
+  // Use BumpEdgeTrigger_Init() instead to get one interrupt per edge
+  Debounce_Init(&Bump_Read_Input, &Bump_Edge, 0xED, 3000, 5);
+
+  LowPower_Init();          // Measure the time spent sleeping from here
   EnableInterrupts();       // Clear the I bit
 
   // Run forever
   while(1){
 
 	// This section is used for Example 1 (seciton 5.8.1)
-    __no_operation();		// the code will run without operation
+    while(BumpFifo_Get(&event)){	// run the reaction of every bump recorded by the ISR
+        // the switch of the event plus any other switch still pressed
+        Bump_Reaction(Bump_VectorPattern(event.vector)|Bump_Pattern(Debounce_State()));
+    }
+    DisableInterrupts();        // no event can slip in between the check and the sleep
+    if(BumpFifo_Empty()){
+        LowPower_Sleep();       // LPM0 until the next interrupt, see LowPower_ActivePercent()
+    }
+    EnableInterrupts();         // the interrupt that woke us up runs here
 
     // This section is used for Example 2 (section 5.8.2)
 	/*
         status = Bump_Read_Input();
-        if (status == 0x6D || status == 0xAD || status == 0xCD || status == 0xE5 || status == 0xE9 || status == 0xEC) {
+        if (status != 0xED) {  // any switch or combination of switches
             checkbumpswitch(status);
         }
 	*/
 	
 	// This section is used for Example 3 (section 5.8.3)
-		// Move forward with 500 duty but can run with any number for time_ms,
-		// in this case, the robot will move infinitely because of the while loop,
-		// (although the time_ms used is 1)
+		// Move forward with 500 duty whenever no bump reaction is running,
+		// the hardware PWM keeps the motors going without the CPU
 	/*
-		Motor_ForwardSimple(500, 1);
+		if(!Motion_Busy()){
+			Motor_SetDirection(MOTOR_FORWARD);
+			Motor_SetDuty(500, 500);
+		}
 	*/
 
   }
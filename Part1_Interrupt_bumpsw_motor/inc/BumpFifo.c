@@ -0,0 +1,121 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        BumpFifo.c
+// Function:    Lock-free FIFO of bump switch events from PORT4_IRQHandler
+
+// The Port 4 ISR only reads P4->IV, stamps the time and puts the event
+// in this FIFO (or the debouncer does it with BumpFifo_Put).  The reaction runs later in the main loop (or a task).
+// There is exactly one producer (one ISR) which writes PutI, and one
+// consumer which writes GetI, so no critical section is needed.
+// An event is copied into its slot before PutI is advanced, so the
+// consumer never sees a half written event.  The slots are volatile like
+// the indexes, so the compiler cannot move a slot store after the store
+// that publishes PutI (the M4 itself does not reorder stores).
+
+#include <stdint.h>
+#include "msp.h"
+#include "TimeBase.h"
+#include "BumpFifo.h"
+
+static volatile BumpEvent_t BumpFifo[BUMPFIFO_SIZE];
+static volatile uint32_t PutI;      // index of where to put next, ISR only
+static volatile uint32_t GetI;      // index of where to get next, consumer only
+static void (*NotifyTask)(void);    // wake up the consumer, can be 0
+
+volatile uint32_t BumpFifo_Lost;
+volatile uint32_t BumpFifo_MaxIsrCycles;
+
+void BumpFifo_Init(void(*notify)(void)){
+  NotifyTask = notify;
+  PutI = GetI = 0;
+  BumpFifo_Lost = 0;
+  BumpFifo_MaxIsrCycles = 0;
+}
+
+// Copy one event into the next free slot, returns the new put index
+static uint32_t BumpFifo_Add(uint32_t put, uint64_t time, uint8_t vector){
+  if((put - GetI) < BUMPFIFO_SIZE){
+    BumpFifo[put&(BUMPFIFO_SIZE-1)].time = time;
+    BumpFifo[put&(BUMPFIFO_SIZE-1)].vector = vector;
+    put++;
+  }else{
+    BumpFifo_Lost++;                // full, drop the newest event
+  }
+  return put;
+}
+
+void BumpFifo_Put(uint8_t vector){
+  uint32_t first, put;
+  first = PutI;
+  put = BumpFifo_Add(first, TimeBase_Now(), vector);
+  PutI = put;                       // publish after the slot is written
+  if((put != first) && NotifyTask){
+    (*NotifyTask)();
+  }
+}
+
+void BumpFifo_Isr(void){
+  uint64_t start;
+  uint32_t first;
+  uint32_t put;
+  uint32_t cycles;
+  uint8_t vector;
+  start = TimeBase_Now();
+  put = first = PutI;
+  // each read of P4->IV returns and clears the highest priority flag
+  while((vector = P4->IV) != 0){
+    put = BumpFifo_Add(put, start, vector);
+  }
+  PutI = put;                       // publish after the slots are written
+  if((put != first) && NotifyTask){
+    (*NotifyTask)();
+  }
+  cycles = (uint32_t)(TimeBase_Now() - start);
+  if(cycles > BumpFifo_MaxIsrCycles){
+    BumpFifo_MaxIsrCycles = cycles;
+  }
+}
+
+int BumpFifo_Get(BumpEvent_t *event){
+  uint32_t get = GetI;
+  if(get == PutI){
+    return 0;                       // empty
+  }
+  *event = BumpFifo[get&(BUMPFIFO_SIZE-1)];
+  GetI = get + 1;                   // release the slot after the copy
+  return 1;
+}
+
+int BumpFifo_Empty(void){
+  return GetI == PutI;
+}
@@ -0,0 +1,104 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        BumpFifo.h
+// Function:    header file of BumpFifo.c
+
+#ifndef BUMPFIFO_H_
+#define BUMPFIFO_H_
+
+// One bump switch event as seen by PORT4_IRQHandler
+typedef struct {
+  uint64_t time;      // TimeBase_Now() when the ISR ran, in bus cycles
+  uint8_t  vector;    // value read from P4->IV, 0x02 (P4.0) to 0x10 (P4.7)
+} BumpEvent_t;
+
+// Number of events the FIFO can hold, must be a power of 2
+#define BUMPFIFO_SIZE 16
+
+/**
+ * Initialize the bump event FIFO
+ *
+ * @param  notify is called from the ISR after events were added, for
+ *         example to wake a FreeRTOS task with vTaskNotifyGiveFromISR.
+ *         It can be 0 when the main loop polls the FIFO.
+ * @return none
+ * @brief  Initialize the bump event FIFO
+ */
+void BumpFifo_Init(void(*notify)(void));
+
+/**
+ * Record every pending Port 4 edge in the FIFO
+ *
+ * @param  none
+ * @return none
+ * @note   Called from PORT4_IRQHandler, the only producer.  Reads P4->IV
+ *         until it is empty, so switches closing together are all kept.
+ * @brief  Port 4 interrupt work
+ */
+void BumpFifo_Isr(void);
+
+/**
+ * Record one bump event, stamped with the current time
+ *
+ * @param  vector is the P4->IV value of the switch, 2*(pin+1)
+ * @return none
+ * @note   For producers other than PORT4_IRQHandler, e.g. the debouncer.
+ *         Use either BumpFifo_Isr or BumpFifo_Put, never both.
+ * @brief  Put a bump event
+ */
+void BumpFifo_Put(uint8_t vector);
+
+/**
+ * Remove the oldest bump event from the FIFO
+ *
+ * @param  event is where the event is copied to
+ * @return 1 if an event was removed, 0 if the FIFO was empty
+ * @note   Only one consumer (main loop or one task) may call this
+ * @brief  Get a bump event
+ */
+int BumpFifo_Get(BumpEvent_t *event);
+
+/**
+ * Check whether there are bump events waiting
+ *
+ * @param  none
+ * @return 1 if the FIFO is empty, 0 otherwise
+ * @brief  Bump event FIFO empty
+ */
+int BumpFifo_Empty(void);
+
+// Statistics, read them in the debugger
+extern volatile uint32_t BumpFifo_Lost;         // events dropped because the FIFO was full
+extern volatile uint32_t BumpFifo_MaxIsrCycles; // longest BumpFifo_Isr, in bus cycles
+
+#endif
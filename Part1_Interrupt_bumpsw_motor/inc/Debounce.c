@@ -0,0 +1,99 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        Debounce.c
+// Function:    Timer sampled debouncer for up to eight switches
+
+// Instead of one interrupt per contact bounce, all switches are sampled
+// at a fixed rate and every bit gets its own 3-bit counter.  The counters
+// are "vertical": bit n of Count0, Count1 and Count2 together form the
+// counter of switch n, so all eight counters are updated at once with a
+// few logic operations, whatever the switches are doing.
+// A counter counts the samples in a row that differ from the debounced
+// state and is cleared as soon as a sample agrees with it.  When it
+// reaches Samples the debounced bit flips.
+
+#include <stdint.h>
+#include "msp.h"
+#include "TimerA2.h"
+#include "Debounce.h"
+
+static uint8_t State;               // debounced inputs
+static uint8_t Count0, Count1, Count2;  // vertical counter, bit 0 to bit 2
+static uint8_t Samples0, Samples1, Samples2;    // Samples spread over all 8 bits
+static uint8_t Mask;                // bits that are debounced
+static uint8_t (*ReadTask)(void);   // raw input
+static void (*EdgeTask)(uint8_t pressed, uint8_t released);
+
+uint8_t Debounce_Step(uint8_t sample){
+  uint8_t delta, reached;
+  delta = (sample^State)&Mask;      // bits that disagree with the state
+  // count up where they disagree, clear where they agree
+  Count2 = (Count2^(Count1&Count0))&delta;
+  Count1 = (Count1^Count0)&delta;
+  Count0 = ~Count0&delta;
+  // bits whose counter equals Samples
+  reached = delta&~((Count0^Samples0)|(Count1^Samples1)|(Count2^Samples2));
+  State ^= reached;
+  Count0 &= ~reached;
+  Count1 &= ~reached;
+  Count2 &= ~reached;
+  return reached;
+}
+
+uint8_t Debounce_State(void){
+  return State;
+}
+
+// Timer A2 task, runs once per sample period
+static void Debounce_Sample(void){
+  uint8_t changed;
+  changed = Debounce_Step((*ReadTask)());
+  if(changed && EdgeTask){
+    (*EdgeTask)(changed&~State, changed&State);
+  }
+}
+
+void Debounce_Init(uint8_t(*read)(void), void(*edge)(uint8_t pressed, uint8_t released),
+                   uint8_t mask, uint16_t period, uint8_t samples){
+  if(samples < 1) samples = 1;
+  if(samples > DEBOUNCE_MAXSAMPLES) samples = DEBOUNCE_MAXSAMPLES;
+  ReadTask = read;
+  EdgeTask = edge;
+  Mask = mask;
+  Samples0 = (samples&0x01) ? 0xFF : 0x00;
+  Samples1 = (samples&0x02) ? 0xFF : 0x00;
+  Samples2 = (samples&0x04) ? 0xFF : 0x00;
+  Count0 = Count1 = Count2 = 0;
+  State = (*ReadTask)();            // start from the current inputs, no edges
+  TimerA2_Init(&Debounce_Sample, period);
+}
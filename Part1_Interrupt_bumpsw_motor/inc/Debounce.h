@@ -0,0 +1,79 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        Debounce.h
+// Function:    header file of Debounce.c
+
+#ifndef DEBOUNCE_H_
+#define DEBOUNCE_H_
+
+// Largest number of equal samples Debounce_Init accepts
+#define DEBOUNCE_MAXSAMPLES 7
+
+/**
+ * Start sampling and debouncing the switches on Timer A2
+ *
+ * @param  read returns the raw switch inputs, e.g. Bump_Read_Input
+ * @param  edge is called from the ISR with the bits that were just
+ *         debounced to 0 (pressed, negative logic) and to 1 (released)
+ * @param  mask selects the bits to debounce, e.g. 0xED for the bump switches
+ * @param  period is the sample period in units (4/SMCLK), 3000 is 1ms
+ * @param  samples is how many equal samples in a row change a bit, 1 to 7.
+ *         The latency is samples*period.
+ * @return none
+ * @note   Assumes Clock_Init48MHz has been called
+ * @brief  Initialize the debouncer
+ */
+void Debounce_Init(uint8_t(*read)(void), void(*edge)(uint8_t pressed, uint8_t released),
+                   uint8_t mask, uint16_t period, uint8_t samples);
+
+/**
+ * Feed one sample of all switches into the debouncer
+ *
+ * @param  sample is the raw input, one bit per switch
+ * @return bits whose debounced value changed with this sample
+ * @note   Called by the Timer A2 ISR, it can also be called directly to
+ *         replay a recorded trace without any hardware
+ * @brief  Debounce one sample
+ */
+uint8_t Debounce_Step(uint8_t sample);
+
+/**
+ * Read the debounced switch state
+ *
+ * @param  none
+ * @return debounced inputs, same polarity as the read function
+ * @brief  Debounced state
+ */
+uint8_t Debounce_State(void);
+
+#endif
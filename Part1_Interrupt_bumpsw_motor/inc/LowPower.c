@@ -0,0 +1,72 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        LowPower.c
+// Function:    Sleep between interrupts and measure the sleep residency
+
+// The main loop sleeps in LPM0 whenever it has nothing to do.  LPM0 stops
+// the CPU clock only, SMCLK keeps running, so the motor PWM (Timer A0),
+// the motion engine (Timer A1), the debouncer (Timer A2) and the time base
+// (Timer32) all carry on and wake the CPU.  LPM3 would stop SMCLK and with
+// it all of these timers, so it is not used here.
+
+#include <stdint.h>
+#include "msp.h"
+#include "CortexM.h"
+#include "TimeBase.h"
+#include "LowPower.h"
+
+uint64_t LowPower_SleepCycles;
+uint64_t LowPower_TotalCycles;
+static uint64_t StartTime;
+
+void LowPower_Init(void){
+  SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;   // WFI enters sleep (LPM0), not deep sleep
+  StartTime = TimeBase_Now();
+  LowPower_SleepCycles = 0;
+  LowPower_TotalCycles = 0;
+}
+
+void LowPower_Sleep(void){
+  uint64_t before, after;
+  before = TimeBase_Now();
+  WaitForInterrupt();                   // wakes on any pending interrupt, even with I=1
+  after = TimeBase_Now();
+  LowPower_SleepCycles += after - before;
+  LowPower_TotalCycles = after - StartTime;
+}
+
+uint32_t LowPower_ActivePercent(void){
+  uint64_t total = LowPower_TotalCycles;
+  if(total == 0) return 100;
+  return (uint32_t)(100 - (100*LowPower_SleepCycles)/total);
+}
@@ -0,0 +1,75 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        LowPower.h
+// Function:    header file of LowPower.c
+
+#ifndef LOWPOWER_H_
+#define LOWPOWER_H_
+
+/**
+ * Start measuring active and sleep time
+ *
+ * @param  none
+ * @return none
+ * @note   Uses the time base, call after SysTick_Init/TimeBase_Init
+ * @brief  Initialize the sleep accounting
+ */
+void LowPower_Init(void);
+
+/**
+ * Sleep in LPM0 (WFI) until the next interrupt
+ *
+ * @param  none
+ * @return none
+ * @note   Call with interrupts disabled (DisableInterrupts or StartCritical)
+ *         right after checking there is no work left.  An interrupt that
+ *         arrives after the check stays pending and ends the sleep at once,
+ *         it runs when interrupts are enabled again.
+ * @brief  Sleep until an interrupt
+ */
+void LowPower_Sleep(void);
+
+/**
+ * Percentage of time spent awake since LowPower_Init
+ *
+ * @param  none
+ * @return 0 to 100
+ * @brief  Active residency
+ */
+uint32_t LowPower_ActivePercent(void);
+
+// Residency in bus cycles, read them in the debugger
+extern uint64_t LowPower_SleepCycles;   // time spent in LowPower_Sleep
+extern uint64_t LowPower_TotalCycles;   // time since LowPower_Init, updated on each sleep
+
+#endif
@@ -0,0 +1,208 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        Motion.c
+// Function:    Non-blocking motion scripts executed from the Timer A1 interrupt
+
+// A reaction such as "backward 200ms, stop 1000ms, turn left 100ms" is
+// put into a FIFO as a list of segments and the function returns.
+// Timer A1 interrupts every 1ms, counts down the running segment and
+// loads the next one into the hardware PWM when the time is up.
+// The motors stop by themselves once the FIFO is empty.
+// The duty never jumps: every change of segment starts a ramp from the
+// speed the wheels have now to the speed of the new segment.  The ramp
+// shapes are tables the compiler fills in, the tick reads one entry per
+// 1ms, multiplies and shifts, no divide and no floating point.
+
+#include <stdint.h>
+#include "msp.h"
+#include "CortexM.h"
+#include "TimerA1.h"
+#include "motor.h"
+#include "Motion.h"
+
+static MotionSegment_t MotionFifo[MOTION_FIFOSIZE];
+static volatile uint32_t PutI;      // index of where to put next
+static volatile uint32_t GetI;      // index of where to get next
+static volatile uint16_t Remaining; // ms left in the running segment
+static volatile uint8_t Running;    // 1 while a segment is loaded
+static void (*ColorTask)(uint8_t);  // LED function, can be 0
+
+// Ramp shapes, fraction of the speed change done after step i, Q15
+#define RAMP_N            MOTION_RAMP_STEPS
+#define RAMP_LINEAR(i)    ((uint16_t)(32768LL*((i)+1)/RAMP_N))
+// smoothstep 3t^2-2t^3 with t=(i+1)/N, zero acceleration at both ends
+#define RAMP_SCURVE(i)    ((uint16_t)(32768LL*(3LL*((i)+1)*((i)+1)*RAMP_N - 2LL*((i)+1)*((i)+1)*((i)+1)) \
+                                      /((long long)RAMP_N*RAMP_N*RAMP_N)))
+#define RAMP_ROW(f,i)     f((i)+0), f((i)+1), f((i)+2), f((i)+3), \
+                          f((i)+4), f((i)+5), f((i)+6), f((i)+7)
+
+// The tables below are written out as 8 rows of 8, a different
+// MOTION_RAMP_STEPS must not compile until they are
+typedef char RampStepsMustBe64[(RAMP_N == 64) ? 1 : -1];
+
+// Generated by the compiler, 2*64 halfwords in flash
+static const uint16_t RampTrapezoid[RAMP_N] = {
+  RAMP_ROW(RAMP_LINEAR,0),  RAMP_ROW(RAMP_LINEAR,8),  RAMP_ROW(RAMP_LINEAR,16), RAMP_ROW(RAMP_LINEAR,24),
+  RAMP_ROW(RAMP_LINEAR,32), RAMP_ROW(RAMP_LINEAR,40), RAMP_ROW(RAMP_LINEAR,48), RAMP_ROW(RAMP_LINEAR,56)
+};
+static const uint16_t RampSCurve[RAMP_N] = {
+  RAMP_ROW(RAMP_SCURVE,0),  RAMP_ROW(RAMP_SCURVE,8),  RAMP_ROW(RAMP_SCURVE,16), RAMP_ROW(RAMP_SCURVE,24),
+  RAMP_ROW(RAMP_SCURVE,32), RAMP_ROW(RAMP_SCURVE,40), RAMP_ROW(RAMP_SCURVE,48), RAMP_ROW(RAMP_SCURVE,56)
+};
+
+static const uint16_t *Ramp = RampSCurve;   // 0 for no ramp
+static int16_t FromL, FromR;        // signed duty when the ramp started, + is forward
+static int16_t ToL, ToR;            // signed duty at the end of the ramp
+static int16_t NowL, NowR;          // signed duty on the motors
+static uint8_t RampI = RAMP_N;      // ramp cursor, RAMP_N when done
+
+// Write a signed duty to each wheel
+static void Motion_Output(int16_t left, int16_t right){
+  NowL = left;
+  NowR = right;
+  Motor_Set(left, right);
+}
+
+// Ramp from the present duty to a new one
+static void Motion_RampTo(int16_t left, int16_t right){
+  FromL = NowL;
+  FromR = NowR;
+  ToL = left;
+  ToR = right;
+  if(Ramp){
+    RampI = 0;
+  }else{
+    RampI = RAMP_N;
+    Motion_Output(left, right);
+  }
+}
+
+// Advance the ramp by one step, one table load
+static void Motion_RampStep(void){
+  int32_t f;
+  if(RampI >= RAMP_N) return;
+  f = Ramp[RampI++];
+  Motion_Output(FromL + (((ToL-FromL)*f)>>15), FromR + (((ToR-FromR)*f)>>15));
+}
+
+// Timer A1 task, runs every 1ms
+static void Motion_Tick(void){
+  MotionSegment_t *seg;
+  int16_t duty;
+  Motion_RampStep();
+  Motor_PowerTick();
+  if(Remaining){
+    Remaining--;
+    if(Remaining) return;       // segment still running
+  }
+  if(GetI == PutI){             // FIFO empty
+    if(Running){
+      if(ToL || ToR){
+        Motion_RampTo(0, 0);    // ramp down to a stop
+      }else if(RampI >= RAMP_N){
+        Motor_Stop();
+        if(ColorTask) (*ColorTask)(0);
+        Running = 0;
+      }
+    }
+    return;
+  }
+  seg = &MotionFifo[GetI&(MOTION_FIFOSIZE-1)];
+  duty = seg->duty;
+  Motion_RampTo((seg->dir&0x80) ? duty : -duty, (seg->dir&0x40) ? duty : -duty);
+  if(ColorTask) (*ColorTask)(seg->color);
+  Remaining = seg->time_ms;
+  Running = 1;
+  GetI++;
+}
+
+void Motion_Init(void(*colorTask)(uint8_t)){
+  ColorTask = colorTask;
+  PutI = GetI = 0;
+  Remaining = 0;
+  Running = 0;
+  NowL = NowR = ToL = ToR = 0;
+  RampI = RAMP_N;
+  Motor_Init();
+  TimerA1_Init(&Motion_Tick, 3000); // 1ms with SMCLK=12MHz, divide by 4
+}
+
+int Motion_Enqueue(const MotionSegment_t *script, uint8_t n){
+  uint8_t i;
+  long sr;
+  sr = StartCritical();         // main and Port 4 ISR can both enqueue
+  if((PutI-GetI) + n > MOTION_FIFOSIZE){
+    EndCritical(sr);
+    return 0;                   // not enough room, nothing queued
+  }
+  for(i=0; i<n; i++){
+    MotionFifo[(PutI+i)&(MOTION_FIFOSIZE-1)] = script[i];
+  }
+  PutI += n;
+  EndCritical(sr);
+  return 1;
+}
+
+int Motion_Replace(const MotionSegment_t *script, uint8_t n){
+  uint8_t i;
+  long sr;
+  if(n > MOTION_FIFOSIZE) return 0;
+  sr = StartCritical();
+  GetI = PutI = 0;              // drop whatever was queued
+  for(i=0; i<n; i++){
+    MotionFifo[i] = script[i];
+  }
+  PutI = n;
+  Remaining = 0;                // the running segment ends on the next tick
+  EndCritical(sr);
+  return 1;
+}
+
+void Motion_SetProfile(uint8_t profile){
+  long sr;
+  sr = StartCritical();
+  if(RampI < RAMP_N){
+    RampI = RAMP_N;             // finish the running ramp at once
+    Motion_Output(ToL, ToR);
+  }
+  switch(profile){
+    case MOTION_RAMP_NONE:      Ramp = 0; break;
+    case MOTION_RAMP_TRAPEZOID: Ramp = RampTrapezoid; break;
+    default:                    Ramp = RampSCurve; break;
+  }
+  EndCritical(sr);
+}
+
+int Motion_Busy(void){
+  return Running || (GetI != PutI);
+}
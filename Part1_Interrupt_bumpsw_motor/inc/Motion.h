@@ -0,0 +1,120 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        Motion.h
+// Function:    header file of Motion.c
+
+#ifndef MOTION_H_
+#define MOTION_H_
+
+// One step of a motion script, for example
+// {MOTOR_BACKWARD, 500, GREEN, 200} moves backward at 500 duty for 200ms
+// with the green LED on
+typedef struct {
+  uint8_t  dir;       // MOTOR_FORWARD, MOTOR_BACKWARD, MOTOR_LEFT or MOTOR_RIGHT
+  uint16_t duty;      // 0 (stop) to MOTOR_PERIOD
+  uint8_t  color;     // colour passed to the LED function, 0 is dark
+  uint16_t time_ms;   // duration of this segment in ms
+} MotionSegment_t;
+
+// A whole motion script, e.g. one bump reaction kept in flash
+typedef struct {
+  const MotionSegment_t *segment;   // array of segments
+  uint8_t n;                        // number of segments, 0 for none
+} MotionScript_t;
+
+// Number of segments the queue can hold, must be a power of 2
+#define MOTION_FIFOSIZE 16
+
+// Speed changes are spread over this many 1ms ticks, the tables in
+// Motion.c are written for 64 and it will not compile with another value
+#define MOTION_RAMP_STEPS 64
+
+// Ramp shapes for Motion_SetProfile
+#define MOTION_RAMP_NONE      0   // jump to the new duty
+#define MOTION_RAMP_TRAPEZOID 1   // constant acceleration
+#define MOTION_RAMP_SCURVE    2   // acceleration rises and falls smoothly, default
+
+/**
+ * Initialize the motion engine, the motors and the 1ms Timer A1 tick
+ *
+ * @param  colorTask is called with the colour of every segment started,
+ *         it can be 0 if the LEDs are not used
+ * @return none
+ * @note   Assumes Clock_Init48MHz has been called
+ * @brief  Initialize the motion engine
+ */
+void Motion_Init(void(*colorTask)(uint8_t));
+
+/**
+ * Add segments to the end of the motion queue
+ *
+ * @param  script is an array of segments
+ * @param  n is the number of segments in the array
+ * @return 1 if all segments were queued, 0 if there was not enough room
+ * @note   Returns right away, can be called from main or from an ISR
+ * @brief  Append a motion script
+ */
+int Motion_Enqueue(const MotionSegment_t *script, uint8_t n);
+
+/**
+ * Replace whatever is running with a new motion script
+ *
+ * @param  script is an array of segments
+ * @param  n is the number of segments, at most MOTION_FIFOSIZE
+ * @return 1 if the script was started, 0 if it is too long
+ * @note   Returns right away, the first segment starts on the next tick
+ * @brief  Pre-empt the running script
+ */
+int Motion_Replace(const MotionSegment_t *script, uint8_t n);
+
+/**
+ * Choose how the duty moves from one segment to the next
+ *
+ * @param  profile is MOTION_RAMP_NONE, MOTION_RAMP_TRAPEZOID or MOTION_RAMP_SCURVE
+ * @return none
+ * @note   A ramp that is running ends right away at its final duty
+ * @brief  Select the acceleration profile
+ */
+void Motion_SetProfile(uint8_t profile);
+
+/**
+ * Check whether a script is still running
+ *
+ * @param  none
+ * @return 1 while a segment is running or queued or the motors are
+ *         still ramping down, 0 when idle
+ * @brief  Motion engine busy flag
+ */
+int Motion_Busy(void);
+
+#endif
@@ -0,0 +1,175 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        Odometry.c
+// Function:    Differential-drive odometry, fixed-point and floating-point
+
+// The heading is not integrated: it is recomputed every update from the
+// total step difference of the two wheels, so rounding never accumulates
+// into it.  The position is integrated with the midpoint rule, the centre
+// moves (dl+dr)/2 along the average of the old and new heading, so the
+// error of one update is third order in the heading change.
+// The fixed-point version uses a quarter-wave Q15 sine table where each
+// entry holds two neighbouring samples, one __SMLAD does the linear
+// interpolation.  The floating-point reference is in OdometryFloat.c.
+
+#include <stdint.h>
+#include "msp.h"
+#include "CortexM.h"
+#include "TimeBase.h"
+#include "Tachometer.h"
+#include "Odometry.h"
+#include "OdometryFloat.h"
+
+// mm per step in Q16
+#define ODO_MM_PER_STEP_Q16     ((int32_t)(ODO_MM_PER_STEP*65536.0f + 0.5f))
+// binary angle per step of difference between the wheels, Q16
+#define ODO_ANGLE_PER_STEP_Q16  ((uint32_t)(ODO_MM_PER_STEP/ODO_WHEELBASE_MM*ODO_TURN/(2.0f*3.14159265f)*65536.0f + 0.5f))
+
+// sin(i*pi/128) in Q15, low halfword is sample i and high halfword sample i+1
+#define PAIR(a,b) ((uint32_t)(a) | ((uint32_t)(b)<<16))
+static const uint32_t SinPair[65] = {
+  PAIR(0,804), PAIR(804,1608), PAIR(1608,2410), PAIR(2410,3212),
+  PAIR(3212,4011), PAIR(4011,4808), PAIR(4808,5602), PAIR(5602,6393),
+  PAIR(6393,7179), PAIR(7179,7962), PAIR(7962,8739), PAIR(8739,9512),
+  PAIR(9512,10278), PAIR(10278,11039), PAIR(11039,11793), PAIR(11793,12539),
+  PAIR(12539,13279), PAIR(13279,14010), PAIR(14010,14732), PAIR(14732,15446),
+  PAIR(15446,16151), PAIR(16151,16846), PAIR(16846,17530), PAIR(17530,18204),
+  PAIR(18204,18868), PAIR(18868,19519), PAIR(19519,20159), PAIR(20159,20787),
+  PAIR(20787,21403), PAIR(21403,22005), PAIR(22005,22594), PAIR(22594,23170),
+  PAIR(23170,23731), PAIR(23731,24279), PAIR(24279,24811), PAIR(24811,25329),
+  PAIR(25329,25832), PAIR(25832,26319), PAIR(26319,26790), PAIR(26790,27245),
+  PAIR(27245,27683), PAIR(27683,28105), PAIR(28105,28510), PAIR(28510,28898),
+  PAIR(28898,29268), PAIR(29268,29621), PAIR(29621,29956), PAIR(29956,30273),
+  PAIR(30273,30571), PAIR(30571,30852), PAIR(30852,31113), PAIR(31113,31356),
+  PAIR(31356,31580), PAIR(31580,31785), PAIR(31785,31971), PAIR(31971,32137),
+  PAIR(32137,32285), PAIR(32285,32412), PAIR(32412,32521), PAIR(32521,32609),
+  PAIR(32609,32678), PAIR(32678,32728), PAIR(32728,32757), PAIR(32757,32767),
+  PAIR(32767,32757)
+};
+
+typedef struct {
+  Pose_t  pose;
+  int32_t left;         // encoder counts at the previous update
+  int32_t right;
+  int32_t offset;       // right-left at the origin
+} OdoQ_t;
+
+static OdoQ_t OdoQ;
+static OdoFloat_t OdoF;
+
+int16_t Odometry_Sin(uint16_t angle){
+  uint32_t a = angle&0x3FFF;
+  int32_t s;
+  if(angle&0x4000) a = 0x4000 - a;    // second and fourth quadrant are mirrored
+  // a is 0 to 0x4000: bits 13-8 select the entry, bits 7-0 are the weight
+  s = (int32_t)__SMLAD(SinPair[a>>8], ((a&0xFF)<<16)|(256-(a&0xFF)), 0)>>8;
+  if(angle&0x8000) s = -s;            // third and fourth quadrant are negative
+  return (int16_t)s;
+}
+
+int16_t Odometry_Cos(uint16_t angle){
+  return Odometry_Sin(angle + 0x4000);
+}
+
+static void Odometry_StepQ(OdoQ_t *o, int32_t leftSteps, int32_t rightSteps){
+  int32_t d;
+  uint16_t theta, mid;
+  // distance of the centre, mm Q16
+  d = ((leftSteps - o->left) + (rightSteps - o->right))*ODO_MM_PER_STEP_Q16/2;
+  o->left = leftSteps;
+  o->right = rightSteps;
+  // modulo 2^32 arithmetic keeps the heading exact as the counts wrap
+  theta = (uint16_t)(((uint32_t)(rightSteps - leftSteps - o->offset)*ODO_ANGLE_PER_STEP_Q16 + 0x8000)>>16);
+  mid = o->pose.theta + (int16_t)(theta - o->pose.theta)/2;
+  o->pose.x += (int32_t)(((int64_t)d*Odometry_Cos(mid) + 0x4000)>>15);
+  o->pose.y += (int32_t)(((int64_t)d*Odometry_Sin(mid) + 0x4000)>>15);
+  o->pose.theta = theta;
+}
+
+void Odometry_Init(int32_t leftSteps, int32_t rightSteps){
+  long sr;
+  sr = StartCritical();
+  OdoQ.pose.x = OdoQ.pose.y = 0;
+  OdoQ.pose.theta = 0;
+  OdoQ.left = leftSteps;
+  OdoQ.right = rightSteps;
+  OdoQ.offset = rightSteps - leftSteps;
+  OdometryFloat_Init(&OdoF, leftSteps, rightSteps);
+  EndCritical(sr);
+}
+
+void Odometry_Update(int32_t leftSteps, int32_t rightSteps){
+  Odometry_StepQ(&OdoQ, leftSteps, rightSteps);
+}
+
+void Odometry_UpdateFloat(int32_t leftSteps, int32_t rightSteps){
+  OdometryFloat_Step(&OdoF, leftSteps, rightSteps);
+}
+
+void Odometry_Get(Pose_t *pose){
+  long sr;
+  sr = StartCritical();
+  *pose = OdoQ.pose;
+  EndCritical(sr);
+}
+
+void Odometry_GetFloat(PoseF_t *pose){
+  long sr;
+  sr = StartCritical();
+  *pose = OdoF.pose;
+  EndCritical(sr);
+}
+
+// A gentle left arc, 3 steps left and 4 steps right per update
+#define ODO_BENCH_N 64
+void Odometry_Benchmark(uint32_t *qCycles, uint32_t *floatCycles){
+  OdoQ_t q = {{0, 0, 0}, 0, 0, 0};
+  OdoFloat_t f = {{0.0f, 0.0f, 0.0f}, 0, 0, 0};
+  uint64_t start, overhead;
+  int32_t i;
+  long sr;
+  sr = StartCritical();
+  start = TimeBase_Now();
+  overhead = TimeBase_Now() - start;
+  start = TimeBase_Now();
+  for(i = 1; i <= ODO_BENCH_N; i++){
+    Odometry_StepQ(&q, 3*i, 4*i);
+  }
+  *qCycles = (uint32_t)(TimeBase_Now() - start - overhead)/ODO_BENCH_N;
+  start = TimeBase_Now();
+  for(i = 1; i <= ODO_BENCH_N; i++){
+    OdometryFloat_Step(&f, 3*i, 4*i);
+  }
+  *floatCycles = (uint32_t)(TimeBase_Now() - start - overhead)/ODO_BENCH_N;
+  EndCritical(sr);
+}
@@ -0,0 +1,145 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        Odometry.h
+// Function:    header file of Odometry.c
+
+#ifndef ODOMETRY_H_
+#define ODOMETRY_H_
+
+// Robot geometry
+#define ODO_WHEEL_DIAMETER_MM   70.0f
+#define ODO_WHEELBASE_MM        140.0f
+#define ODO_MM_PER_STEP         (3.14159265f*ODO_WHEEL_DIAMETER_MM/TACH_STEPS_PER_REV)
+
+// Headings are binary angles, 65536 is one turn, so they wrap for free
+#define ODO_TURN                65536
+#define ODO_DEG(x)              ((uint16_t)((x)*ODO_TURN/360))
+
+// Fixed-point pose: x and y in mm, Q16 (+/-32m), heading as a binary angle
+typedef struct {
+  int32_t  x;
+  int32_t  y;
+  uint16_t theta;
+} Pose_t;
+
+// Floating-point pose: x and y in mm, heading in radians (-pi to pi)
+typedef struct {
+  float x;
+  float y;
+  float theta;
+} PoseF_t;
+
+/**
+ * Reset both poses to the origin, facing along x
+ *
+ * @param  leftSteps is the left encoder count at the origin
+ * @param  rightSteps is the right encoder count at the origin
+ * @return none
+ * @brief  Initialize the odometry
+ */
+void Odometry_Init(int32_t leftSteps, int32_t rightSteps);
+
+/**
+ * Integrate the fixed-point pose with the new encoder counts
+ *
+ * @param  leftSteps is the left encoder count, see Tachometer_GetSteps
+ * @param  rightSteps is the right encoder count, see Tachometer_GetSteps
+ * @return none
+ * @note   Call at the control rate, the wheels should move less than
+ *         a few mm between two calls
+ * @brief  Update the fixed-point pose
+ */
+void Odometry_Update(int32_t leftSteps, int32_t rightSteps);
+
+/**
+ * Integrate the floating-point pose with the new encoder counts
+ *
+ * @param  leftSteps is the left encoder count, see Tachometer_GetSteps
+ * @param  rightSteps is the right encoder count, see Tachometer_GetSteps
+ * @return none
+ * @note   Reference for Odometry_Update, uses the FPU and sinf/cosf.
+ *         The arithmetic is in OdometryFloat.c, which builds on the host.
+ * @brief  Update the floating-point pose
+ */
+void Odometry_UpdateFloat(int32_t leftSteps, int32_t rightSteps);
+
+/**
+ * Read the fixed-point pose
+ *
+ * @param  pose is filled with the current pose
+ * @return none
+ * @brief  Get the fixed-point pose
+ */
+void Odometry_Get(Pose_t *pose);
+
+/**
+ * Read the floating-point pose
+ *
+ * @param  pose is filled with the current pose
+ * @return none
+ * @brief  Get the floating-point pose
+ */
+void Odometry_GetFloat(PoseF_t *pose);
+
+/**
+ * Sine of a binary angle
+ *
+ * @param  angle is the angle, 65536 is one turn
+ * @return sine in Q15, -32767 to 32767
+ * @note   Quarter-wave table with linear interpolation, error at most 4 LSB
+ * @brief  Table sine
+ */
+int16_t Odometry_Sin(uint16_t angle);
+
+/**
+ * Cosine of a binary angle
+ *
+ * @param  angle is the angle, 65536 is one turn
+ * @return cosine in Q15, -32767 to 32767
+ * @brief  Table cosine
+ */
+int16_t Odometry_Cos(uint16_t angle);
+
+/**
+ * Measure the cost of both update functions
+ *
+ * @param  qCycles is the average bus cycles of one Odometry_Update
+ * @param  floatCycles is the average bus cycles of one Odometry_UpdateFloat
+ * @return none
+ * @note   Runs on private copies of the pose with interrupts disabled
+ *         for about 1ms, needs TimeBase_Init
+ * @brief  Benchmark the odometry
+ */
+void Odometry_Benchmark(uint32_t *qCycles, uint32_t *floatCycles);
+
+#endif
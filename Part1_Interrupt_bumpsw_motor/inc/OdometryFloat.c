@@ -0,0 +1,67 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        OdometryFloat.c
+// Function:    Floating-point reference of the odometry in Odometry.c
+
+// Same scheme as the fixed-point version, heading recomputed from the
+// step difference and position integrated with the midpoint rule, in
+// single precision with sinf/cosf.  It uses no peripheral and no
+// intrinsic, so it builds unchanged on the host as the reference the
+// fixed-point path is checked against (tools/test_odometry.c).
+// Odometry.c wraps it with the critical sections.
+
+#include <stdint.h>
+#include <math.h>
+#include "Tachometer.h"
+#include "Odometry.h"
+#include "OdometryFloat.h"
+
+void OdometryFloat_Init(OdoFloat_t *o, int32_t leftSteps, int32_t rightSteps){
+  o->pose.x = o->pose.y = o->pose.theta = 0.0f;
+  o->left = leftSteps;
+  o->right = rightSteps;
+  o->offset = rightSteps - leftSteps;
+}
+
+void OdometryFloat_Step(OdoFloat_t *o, int32_t leftSteps, int32_t rightSteps){
+  float d, theta, mid;
+  d = (float)((leftSteps - o->left) + (rightSteps - o->right))*(ODO_MM_PER_STEP/2.0f);
+  o->left = leftSteps;
+  o->right = rightSteps;
+  theta = (float)(rightSteps - leftSteps - o->offset)*(ODO_MM_PER_STEP/ODO_WHEELBASE_MM);
+  theta = remainderf(theta, 2.0f*3.14159265f);    // -pi to pi
+  mid = o->pose.theta + remainderf(theta - o->pose.theta, 2.0f*3.14159265f)/2.0f;
+  o->pose.x += d*cosf(mid);
+  o->pose.y += d*sinf(mid);
+  o->pose.theta = theta;
+}
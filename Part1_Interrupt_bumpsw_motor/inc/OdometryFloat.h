@@ -0,0 +1,70 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        OdometryFloat.h
+// Function:    header file of OdometryFloat.c
+
+#ifndef ODOMETRYFLOAT_H_
+#define ODOMETRYFLOAT_H_
+
+// State of one floating-point odometry, include Odometry.h first
+typedef struct {
+  PoseF_t pose;
+  int32_t left;         // encoder counts at the previous update
+  int32_t right;
+  int32_t offset;       // right-left at the origin
+} OdoFloat_t;
+
+/**
+ * Reset a floating-point pose to the origin, facing along x
+ *
+ * @param  o is the odometry state
+ * @param  leftSteps is the left encoder count at the origin
+ * @param  rightSteps is the right encoder count at the origin
+ * @return none
+ * @brief  Initialize the floating-point odometry
+ */
+void OdometryFloat_Init(OdoFloat_t *o, int32_t leftSteps, int32_t rightSteps);
+
+/**
+ * Integrate a floating-point pose with the new encoder counts
+ *
+ * @param  o is the odometry state
+ * @param  leftSteps is the left encoder count
+ * @param  rightSteps is the right encoder count
+ * @return none
+ * @note   Plain C with sinf/cosf, no hardware access
+ * @brief  Update the floating-point pose
+ */
+void OdometryFloat_Step(OdoFloat_t *o, int32_t leftSteps, int32_t rightSteps);
+
+#endif
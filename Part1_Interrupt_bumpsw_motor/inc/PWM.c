@@ -0,0 +1,77 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Right motor PWM connected to P2.6/TA0CCP3 (J4.39)
+// Left motor PWM connected to P2.7/TA0CCP4 (J4.40)
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        PWM.c
+// Function:    Hardware PWM on Timer A0 for the DC motors
+
+#include <stdint.h>
+#include "msp.h"
+
+// The PWM is generated by Timer A0, so the CPU does not toggle any pin.
+// SMCLK = 12MHz, divide by 1, up-down mode
+// CCR0 holds the period, CCR3 and CCR4 hold the high time of each output
+// For example, period=1000 gives 12MHz/(2*1000) = 6kHz PWM
+//              and duty=500 gives a 50% duty cycle
+static uint16_t PWM_Period = 0;
+
+void PWM_Init34(uint16_t period, uint16_t duty3, uint16_t duty4){
+  if(duty3 >= period) return;   // bad input
+  if(duty4 >= period) return;   // bad input
+  PWM_Period = period;
+  P2->DIR |= 0xC0;              // P2.6, P2.7 output
+  P2->SEL0 |= 0xC0;             // P2.6, P2.7 Timer0A functions
+  P2->SEL1 &= ~0xC0;            // P2.6, P2.7 Timer0A functions
+  TIMER_A0->CTL = 0x0004;       // halt Timer A0 and clear TAR while configuring
+  TIMER_A0->CCTL[0] = 0x0080;   // CCI0 toggle
+  TIMER_A0->CCR[0] = period;    // Period is 2*period*83.33ns
+  TIMER_A0->EX0 = 0x0000;       // divide by 1
+  TIMER_A0->CCTL[3] = 0x0040;   // CCR3 toggle/reset
+  TIMER_A0->CCR[3] = duty3;     // CCR3 duty cycle is duty3/period
+  TIMER_A0->CCTL[4] = 0x0040;   // CCR4 toggle/reset
+  TIMER_A0->CCR[4] = duty4;     // CCR4 duty cycle is duty4/period
+  TIMER_A0->CTL = 0x0230;       // SMCLK=12MHz, divide by 1, up-down mode
+}
+
+// Set the high time of P2.6, returns right away
+void PWM_Duty3(uint16_t duty3){
+  if(duty3 >= PWM_Period) return; // bad input
+  TIMER_A0->CCR[3] = duty3;     // CCR3 duty cycle is duty3/period
+}
+
+// Set the high time of P2.7, returns right away
+void PWM_Duty4(uint16_t duty4){
+  if(duty4 >= PWM_Period) return; // bad input
+  TIMER_A0->CCR[4] = duty4;     // CCR4 duty cycle is duty4/period
+}
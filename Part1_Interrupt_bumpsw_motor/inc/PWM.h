@@ -0,0 +1,73 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        PWM.h
+// Function:    header file of PWM.c
+
+#ifndef PWM_H_
+#define PWM_H_
+
+/**
+ * Initialize Timer A0 to generate two PWM outputs
+ * on P2.6/TA0CCP3 (right motor) and P2.7/TA0CCP4 (left motor)
+ *
+ * @param  period is the PWM period in 83.33 ns units (SMCLK=12MHz)
+ * @param  duty3 is the initial high time of P2.6, 0 <= duty3 < period
+ * @param  duty4 is the initial high time of P2.7, 0 <= duty4 < period
+ * @return none
+ * @note   Timer A0 runs in up-down mode, so the PWM frequency is
+ *         12MHz/(2*period).  Assumes Clock_Init48MHz has been called.
+ * @brief  Initialize hardware PWM on P2.6 and P2.7
+ */
+void PWM_Init34(uint16_t period, uint16_t duty3, uint16_t duty4);
+
+/**
+ * Set the duty cycle of the PWM output on P2.6 (right motor)
+ *
+ * @param  duty3 is the new high time, 0 <= duty3 < period
+ * @return none
+ * @note   Returns right away, the new value takes effect on the next period
+ * @brief  Set the duty cycle on P2.6
+ */
+void PWM_Duty3(uint16_t duty3);
+
+/**
+ * Set the duty cycle of the PWM output on P2.7 (left motor)
+ *
+ * @param  duty4 is the new high time, 0 <= duty4 < period
+ * @return none
+ * @note   Returns right away, the new value takes effect on the next period
+ * @brief  Set the duty cycle on P2.7
+ */
+void PWM_Duty4(uint16_t duty4);
+
+#endif
@@ -0,0 +1,156 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        SpeedControl.c
+// Function:    Closed-loop wheel speed PI controller at 1kHz
+
+// Every 1ms the SysTick ISR reads the tachometers, computes the speed of
+// each wheel in rpm and runs a PI controller that writes the PWM duty.
+// It also updates the fixed-point pose (Odometry.c).
+// All the arithmetic is integer: the gains are Q15 and the integral term
+// is kept in Q15 duty units.
+// Anti-windup: while the output is saturated the integral only moves in
+// the direction that brings the output back into range.
+
+#include <stdint.h>
+#include "msp.h"
+#include "Clock.h"
+#include "TimeBase.h"
+#include "Tachometer.h"
+#include "motor.h"
+#include "Odometry.h"
+#include "SpeedControl.h"
+
+// A wheel with no edge for this long is stopped (below 500000/(20*3000) = 8 rpm)
+#define SPEED_STALL_MS  20
+
+typedef struct {
+  int32_t  target;      // rpm
+  int32_t  integral;    // Q15 duty units
+  uint32_t lastEdges;   // tachometer edge count at the previous iteration
+  uint16_t age;         // ms since the last edge
+  uint16_t rpm;         // measured speed
+} SpeedWheel_t;
+
+static SpeedWheel_t Left, Right;
+static int32_t Kp = SPEED_KP;
+static int32_t Ki = SPEED_KI;
+
+volatile uint16_t SpeedControl_LeftRpm, SpeedControl_RightRpm;
+volatile uint32_t SpeedControl_Cycles;
+volatile uint32_t SpeedControl_MaxCycles;
+
+// Update the speed of one wheel from its tachometer
+static void SpeedControl_Measure(SpeedWheel_t *w, uint16_t period, uint32_t edges){
+  if(edges != w->lastEdges){
+    w->lastEdges = edges;
+    w->age = 0;
+    w->rpm = (period != 0) ? TACH_RPM_CONSTANT/period : 0;
+  }else if(w->age < SPEED_STALL_MS){
+    w->age++;
+  }else{
+    w->rpm = 0;                       // no edge for too long
+  }
+}
+
+// One PI iteration, returns the duty for this wheel
+// The gain products are 64-bit: a Q15 gain of 4.0 times an error of
+// 65535 rpm is already 2^33
+static uint16_t SpeedControl_PI(SpeedWheel_t *w){
+  int32_t error;
+  int64_t u, integral;
+  if(w->target == 0){
+    w->integral = 0;
+    return 0;
+  }
+  error = w->target - w->rpm;
+  integral = w->integral + (int64_t)Ki*error;
+  u = ((int64_t)Kp*error + integral)>>15;   // Q15 to duty units
+  if(u >= MOTOR_PERIOD){
+    u = MOTOR_PERIOD-1;
+    if(error >= 0) integral = w->integral;  // only unwind
+  }else if(u < 0){
+    u = 0;
+    if(error <= 0) integral = w->integral;  // only unwind
+  }
+  if(integral < 0) integral = 0;
+  if(integral > ((int32_t)MOTOR_PERIOD<<15)) integral = (int32_t)MOTOR_PERIOD<<15;
+  w->integral = (int32_t)integral;
+  return (uint16_t)u;
+}
+
+void SpeedControl_Init(void){
+  Left.target = Right.target = 0;
+  Left.integral = Right.integral = 0;
+  Left.rpm = Right.rpm = 0;
+  Left.age = Right.age = SPEED_STALL_MS;
+  SpeedControl_MaxCycles = 0;
+  Motor_Init();
+  Tachometer_Init();
+  Odometry_Init(0, 0);
+  SysTick->CTRL = 0;                  // disable SysTick during setup
+  SysTick->LOAD = Clock_GetFreq()/1000 - 1;   // 1kHz
+  SysTick->VAL = 0;                   // any write to current clears it
+  SCB->SHP[11] = 0x60;                // priority 3, same as the motion engine
+  SysTick->CTRL = 0x00000007;         // enable SysTick with core clock and interrupts
+}
+
+void SpeedControl_SetTarget(uint16_t leftRpm, uint16_t rightRpm){
+  Left.target = leftRpm;
+  Right.target = rightRpm;
+}
+
+void SpeedControl_SetGains(int32_t kp, int32_t ki){
+  Kp = kp;
+  Ki = ki;
+}
+
+void SysTick_Handler(void){
+  uint64_t start;
+  uint16_t leftPeriod, rightPeriod;
+  uint32_t leftEdges, rightEdges;
+  int32_t leftSteps, rightSteps;
+  start = TimeBase_Now();
+  Tachometer_Get(&leftPeriod, &leftEdges, &rightPeriod, &rightEdges);
+  Tachometer_GetSteps(&leftSteps, &rightSteps);
+  Odometry_Update(leftSteps, rightSteps);
+  SpeedControl_Measure(&Left, leftPeriod, leftEdges);
+  SpeedControl_Measure(&Right, rightPeriod, rightEdges);
+  Motor_SetDuty(SpeedControl_PI(&Left), SpeedControl_PI(&Right));
+  Motor_PowerTick();
+  SpeedControl_LeftRpm = Left.rpm;
+  SpeedControl_RightRpm = Right.rpm;
+  SpeedControl_Cycles = (uint32_t)(TimeBase_Now() - start);
+  if(SpeedControl_Cycles > SpeedControl_MaxCycles){
+    SpeedControl_MaxCycles = SpeedControl_Cycles;
+  }
+}
@@ -0,0 +1,85 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        SpeedControl.h
+// Function:    header file of SpeedControl.c
+
+#ifndef SPEEDCONTROL_H_
+#define SPEEDCONTROL_H_
+
+// Gains are Q15 fixed-point numbers, i.e. the real gain times 32768,
+// in duty units (0 to MOTOR_PERIOD) per rpm of error.
+// They are 32-bit so a gain can be larger than 1.0
+#define SPEED_Q15(x)    ((int32_t)((x)*32768))
+#define SPEED_KP        SPEED_Q15(4.0)    // proportional, duty per rpm
+#define SPEED_KI        SPEED_Q15(0.05)   // integral, duty per rpm per ms
+
+/**
+ * Start the 1kHz speed control loop on SysTick
+ *
+ * @param  none
+ * @return none
+ * @note   Calls Motor_Init, Tachometer_Init and Odometry_Init.  SysTick is free since
+ *         the delays moved to the Timer32 time base (TimeBase.c).
+ *         Do not use together with the motion engine (Motion.c), both
+ *         write the PWM duty.
+ * @brief  Initialize the speed controller
+ */
+void SpeedControl_Init(void);
+
+/**
+ * Set the wheel speeds the controller should hold
+ *
+ * @param  leftRpm is the left wheel speed in rpm, 0 stops the wheel
+ * @param  rightRpm is the right wheel speed in rpm, 0 stops the wheel
+ * @return none
+ * @note   Returns right away, set the direction with Motor_SetDirection
+ * @brief  Set the target speeds
+ */
+void SpeedControl_SetTarget(uint16_t leftRpm, uint16_t rightRpm);
+
+/**
+ * Change the controller gains
+ *
+ * @param  kp is the proportional gain, Q15, see SPEED_Q15
+ * @param  ki is the integral gain, Q15, see SPEED_Q15
+ * @return none
+ * @brief  Tune the controller
+ */
+void SpeedControl_SetGains(int32_t kp, int32_t ki);
+
+// Measurements, read them in the debugger
+extern volatile uint16_t SpeedControl_LeftRpm, SpeedControl_RightRpm;  // measured speeds
+extern volatile uint32_t SpeedControl_Cycles;      // bus cycles of the last iteration
+extern volatile uint32_t SpeedControl_MaxCycles;   // worst iteration so far
+
+#endif
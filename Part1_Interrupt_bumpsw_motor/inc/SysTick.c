@@ -52,48 +52,30 @@ policies, either expressed or implied, of the FreeBSD Project.
 
 #include <stdint.h>
 #include "msp.h"
+#include "TimeBase.h"
 
 
-// Initialize SysTick with busy wait running at bus clock.
+// These functions used to busy-wait on SysTick.  They are now thin
+// wrappers around the Timer32 time base (TimeBase.c), which sleeps in
+// WFI while waiting and leaves SysTick free for other uses.
+// The delays are derived from ClockFrequency, not a fixed 48 MHz.
+
+// Initialize the time base used by the delays.
 void SysTick_Init(void){
-  SysTick->LOAD = 0x00FFFFFF;           // maximum reload value
-  SysTick->CTRL = 0x00000005;           // enable SysTick with no interrupts
+  TimeBase_Init();
 }
-// Time delay using busy wait.
-// The delay parameter is in units of the core clock. 
-// assumes 48 MHz bus clock
+// Time delay, sleeping while waiting.
+// The delay parameter is in units of the core clock.
 void SysTick_Wait(uint32_t delay){
-  // method #1: set Reload Value Register, clear Current Value Register, poll COUNTFLAG in Control and Status Register
-  if(delay <= 1){
-    // without this step:
-    // if delay == 0, this function will wait 0x00FFFFFF cycles
-    // if delay == 1, this function will never return (because COUNTFLAG is set on 1->0 transition)
-    return;                   // do nothing; at least 1 cycle has already passed anyway
-  }
-  SysTick->LOAD = (delay - 1);// count down to zero
-  SysTick->VAL = 0;          // any write to CVR clears it and COUNTFLAG in CSR
-  while(( SysTick->CTRL&0x00010000) == 0){};
-  // method #2: repeatedly evaluate elapsed time
-/*  volatile uint32_t elapsedTime;
-  uint32_t startTime = SYSTICK->VAL;
-  do{
-    elapsedTime = (startTime-SYSTICK->VAL)&0x00FFFFFF;
-  }
-  while(elapsedTime <= delay);*/
+  TimeBase_WaitUntil(TimeBase_Now() + delay);
 }
-// Time delay using busy wait.
-// assumes 48 MHz bus clock
+// Time delay, sleeping while waiting.
+// The delay parameter is in units of 10ms.
 void SysTick_Wait10ms(uint32_t delay){
-  uint32_t i;
-  for(i=0; i<delay; i++){
-    SysTick_Wait(480000);  // wait 10ms (assumes 48 MHz clock)
-  }
+  TimeBase_Wait1ms(10*delay);
+}
+// Time delay, sleeping while waiting.
+// The delay parameter is in units of 1us.
+void SysTick_Wait1us(uint32_t delay){
+  TimeBase_Wait1us(delay);
 }
-
- void SysTick_Wait1us(uint32_t delay){
-   uint32_t i;
-    for(i=0; i<delay; i++){
-       SysTick_Wait(48);
-      }
-  }
-
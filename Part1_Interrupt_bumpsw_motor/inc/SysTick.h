@@ -1,7 +1,7 @@
 /**
  * @file      SysTick.h
  * @brief     Provide functions that initialize the SysTick module
- * @details   Time delay using SysTick busy-wait
+ * @details   Time delay, now implemented by the Timer32 time base
  * @version   V1.0
  * @author    Valvano
  * @copyright Copyright 2017 by Jonathan W. Valvano, valvano@mail.utexas.edu,
@@ -19,6 +19,8 @@
 // consumption by reducing clock frequency.  This matters for the
 // function SysTick_Wait10ms(), which will wait longer than 10 ms if the
 // clock is slower.
+// The functions are kept for compatibility; they now sleep on the Timer32
+// time base (TimeBase.h) and compute the delays from ClockFrequency.
 
 
 /* This example accompanies the books
@@ -60,36 +62,45 @@ policies, either expressed or implied, of the FreeBSD Project.
 */
 
 /**
- * Initialize SysTick with busy wait running at bus clock
+ * Initialize the time base used by the delays
  *
  * @param  none
  * @return none
- * @note   The system bus clock affects this module
- * @brief  Initialize SysTick
+ * @note   Wrapper around TimeBase_Init, SysTick itself is not used
+ * @brief  Initialize the delays
  */
 void SysTick_Init(void);
 
 
 /**
- * Time delay using busy wait
+ * Time delay, sleeping in WFI while waiting
  *
  * @param   delay is the number of bus cycles to wait
  * @return  none
  * @note    The system bus clock affects this module
  * @warning SysTick_Init must be called before calling this function
- * @brief   Time delay using SysTick
+ * @brief   Time delay using the time base
  */
 void SysTick_Wait(uint32_t delay);
 
 /**
- * Time delay using busy wait
+ * Time delay, sleeping in WFI while waiting
  *
  * @param   delay is the time in 10-ms units
  * @return  none
- * @note    assumes 48 MHz bus clock
+ * @note    Derived from ClockFrequency, see Clock.c
  * @warning SysTick_Init must be called before calling this function
- * @brief   Time delay using SysTick
+ * @brief   Time delay using the time base
  */
 void SysTick_Wait10ms(uint32_t delay);
 
+/**
+ * Time delay, sleeping in WFI while waiting
+ *
+ * @param   delay is the time in 1-us units
+ * @return  none
+ * @note    Derived from ClockFrequency, see Clock.c
+ * @warning SysTick_Init must be called before calling this function
+ * @brief   Time delay using the time base
+ */
 void SysTick_Wait1us(uint32_t delay);
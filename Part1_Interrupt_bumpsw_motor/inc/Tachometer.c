@@ -0,0 +1,224 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Left encoder A connected to P10.5/TA3CCP1 (J5)
+// Left encoder B connected to P5.2 (J2.12)
+// Right encoder A connected to P10.4/TA3CCP0 (J5)
+// Right encoder B connected to P5.0 (J2.13)
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        Tachometer.c
+// Function:    Quadrature wheel encoders and speed using Timer A3 input capture
+
+// Both edges of each A channel are captured by Timer A3.  At every edge
+// the level of A is compared with B: equal means the wheel turns
+// forward, different means backward.  The level of A is CCI, the live
+// input (SCCI is only latched on compare, not on capture), read in the
+// ISR.  It still shows the level after the edge as long as the ISR runs
+// before the next edge of A, the same condition as not losing the edge.
+// This gives a signed count of 720 steps per wheel revolution.
+// The speed comes from the time between two rising edges of A.
+// If a whole Timer A3 rollover (21.8ms) passes without an edge the wheel
+// is reported as stopped.
+//
+// Edge rate: Tachometer_EdgeRate measures how many edges per second the
+// CPU can take, interrupt entry and exit included.  It must stay well
+// above 2*720*(wheel revolutions per second).  Defining
+// TACHOMETER_BENCHMARK also records the longest capture ISR body with
+// the DWT cycle counter.
+
+#include <stdint.h>
+#include "msp.h"
+#include "TimeBase.h"
+#include "Tachometer.h"
+
+extern uint32_t ClockFrequency;     // cycles/second, see Clock.c
+
+static volatile uint16_t LeftFirst, RightFirst;     // time of the last rising edge
+static volatile uint16_t LeftPeriod, RightPeriod;   // time between the last two rising edges, 0 if stopped
+static volatile uint32_t LeftEdges, RightEdges;     // edges since Tachometer_Init
+static volatile int32_t LeftSteps, RightSteps;      // signed position, + is forward
+static volatile int8_t LeftDir, RightDir;           // 1 forward, -1 backward
+static uint32_t LeftEdgesAtRollover, RightEdgesAtRollover;
+
+#ifdef TACHOMETER_BENCHMARK
+volatile uint32_t Tachometer_MaxIsrCycles;
+#define BENCH_START()   uint32_t benchStart = DWT->CYCCNT
+#define BENCH_STOP()    do{ uint32_t c = DWT->CYCCNT - benchStart; \
+                            if(c > Tachometer_MaxIsrCycles) Tachometer_MaxIsrCycles = c; }while(0)
+#else
+#define BENCH_START()
+#define BENCH_STOP()
+#endif
+
+void Tachometer_Init(void){
+  LeftPeriod = RightPeriod = 0;
+  LeftEdges = RightEdges = 0;
+  LeftSteps = RightSteps = 0;
+  LeftDir = RightDir = 1;
+  LeftEdgesAtRollover = RightEdgesAtRollover = 0;
+#ifdef TACHOMETER_BENCHMARK
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;  // enable the cycle counter
+  Tachometer_MaxIsrCycles = 0;
+#endif
+  P5->SEL0 &= ~0x05;
+  P5->SEL1 &= ~0x05;              // configure P5.2 and P5.0 as GPIO
+  P5->DIR &= ~0x05;               // make P5.2 and P5.0 in
+  P10->SEL0 |= 0x30;
+  P10->SEL1 &= ~0x30;             // configure P10.5 and P10.4 as TA3CCP1 and TA3CCP0
+  P10->DIR &= ~0x30;              // make P10.5 and P10.4 in
+  TIMER_A3->CTL &= ~0x0030;       // halt Timer A3
+  TIMER_A3->CTL = 0x0282;         // SMCLK, divide by 4, 3MHz, arm rollover (TAIFG)
+  TIMER_A3->CCTL[0] = 0xC910;     // both edges, CCI0A, synchronous, capture, arm
+  TIMER_A3->CCTL[1] = 0xC910;     // both edges, CCI1A, synchronous, capture, arm
+  TIMER_A3->EX0 &= ~0x0007;       // configure for input clock divider /1
+  // priority 2 on Timer A3 CCR0 and CCR1 (IP is byte wide, one entry per interrupt)
+  NVIC->IP[14] = 0x40;
+  NVIC->IP[15] = 0x40;
+  // enable interrupts 14 and 15 in NVIC on Timer A3
+  NVIC->ISER[0] = 0x0000C000;
+  TIMER_A3->CTL |= 0x0024;        // reset and start Timer A3 in continuous mode
+}
+
+void Tachometer_Get(uint16_t *leftPeriod, uint32_t *leftEdges,
+                    uint16_t *rightPeriod, uint32_t *rightEdges){
+  *leftPeriod = LeftPeriod;
+  *leftEdges = LeftEdges;
+  *rightPeriod = RightPeriod;
+  *rightEdges = RightEdges;
+}
+
+void Tachometer_GetSteps(int32_t *leftSteps, int32_t *rightSteps){
+  *leftSteps = LeftSteps;
+  *rightSteps = RightSteps;
+}
+
+void Tachometer_GetSpeed(int16_t *leftRpm, int16_t *rightRpm){
+  uint16_t period;
+  period = LeftPeriod;
+  *leftRpm = period ? LeftDir*(int16_t)(TACH_RPM_CONSTANT/period) : 0;
+  period = RightPeriod;
+  *rightRpm = period ? RightDir*(int16_t)(TACH_RPM_CONSTANT/period) : 0;
+}
+
+// Switch the capture input of CCR0 between GND and VCC in software
+// (CCIS = 10 and 11), each switch is one edge for TA3_0_IRQHandler.
+// The next edge is made as soon as the previous one has been counted,
+// so the time per edge is the whole cost of one edge: capture
+// synchronisation, interrupt entry, ISR and exit, plus the few cycles
+// of this loop.  The right wheel counts are restored afterwards.
+#define TACH_BENCH_N 1000
+uint32_t Tachometer_EdgeRate(void){
+  uint16_t cctl;
+  uint32_t edges, i, e;
+  int32_t steps;
+  uint16_t first, period;
+  int8_t dir;
+  uint64_t start, cycles;
+  cctl = TIMER_A3->CCTL[0];
+  steps = RightSteps;
+  edges = RightEdges;
+  first = RightFirst;
+  period = RightPeriod;
+  dir = RightDir;
+  TIMER_A3->CCTL[0] = (cctl&~0x3000)|0x2000;  // CCIS = GND
+  TimeBase_Wait1us(10);           // a falling edge if A was high
+  start = TimeBase_Now();
+  for(i = 0; i < TACH_BENCH_N; i++){
+    e = RightEdges;
+    TIMER_A3->CCTL[0] ^= 0x1000;  // GND <-> VCC
+    while(RightEdges == e){};
+  }
+  cycles = TimeBase_Now() - start;
+  TIMER_A3->CCTL[0] = cctl&~0x0001;   // back to P10.4
+  TimeBase_Wait1us(10);           // an edge if A differs from the last level
+  RightSteps = steps;
+  RightEdges = edges;
+  RightFirst = first;
+  RightPeriod = period;
+  RightDir = dir;
+  return (uint32_t)((uint64_t)TACH_BENCH_N*ClockFrequency/cycles);
+}
+
+// Right encoder edge, P10.4
+void TA3_0_IRQHandler(void){
+  uint16_t cctl, now;
+  BENCH_START();
+  cctl = TIMER_A3->CCTL[0];
+  TIMER_A3->CCTL[0] = cctl&~0x0001;   // acknowledge capture/compare interrupt 0
+  now = TIMER_A3->CCR[0];
+  if(((cctl>>3)^P5->IN)&0x01){    // A (CCI, bit 3, live) differs from B (P5.0)
+    RightSteps--;
+    RightDir = -1;
+  }else{
+    RightSteps++;
+    RightDir = 1;
+  }
+  if(cctl&0x0008){                // rising edge of A
+    RightPeriod = now - RightFirst;   // 16-bit subtraction handles the rollover
+    RightFirst = now;
+  }
+  RightEdges++;
+  BENCH_STOP();
+}
+
+// Left encoder edge (P10.5) or Timer A3 rollover
+void TA3_N_IRQHandler(void){
+  uint16_t cctl, now;
+  BENCH_START();
+  switch(TIMER_A3->IV){           // reading IV clears the highest pending flag
+    case 0x02:                    // CCR1, left encoder edge
+      cctl = TIMER_A3->CCTL[1];
+      now = TIMER_A3->CCR[1];
+      if(((cctl>>3)^(P5->IN>>2))&0x01){   // A (CCI, bit 3, live) differs from B (P5.2)
+        LeftSteps--;
+        LeftDir = -1;
+      }else{
+        LeftSteps++;
+        LeftDir = 1;
+      }
+      if(cctl&0x0008){            // rising edge of A
+        LeftPeriod = now - LeftFirst;
+        LeftFirst = now;
+      }
+      LeftEdges++;
+      break;
+    case 0x0E:                    // rollover, every 21.8ms
+      if(LeftEdges == LeftEdgesAtRollover) LeftPeriod = 0;    // stopped
+      if(RightEdges == RightEdgesAtRollover) RightPeriod = 0; // stopped
+      LeftEdgesAtRollover = LeftEdges;
+      RightEdgesAtRollover = RightEdges;
+      break;
+  }
+  BENCH_STOP();
+}
@@ -0,0 +1,108 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        Tachometer.h
+// Function:    header file of Tachometer.c
+
+#ifndef TACHOMETER_H_
+#define TACHOMETER_H_
+
+// Wheel speed in rpm is TACH_RPM_CONSTANT/period, where period is the time
+// between two encoder edges in 1/3MHz units and there are 360 edges per
+// wheel revolution: 60*3000000/360 = 500000
+#define TACH_RPM_CONSTANT 500000
+
+// Signed steps per wheel revolution, both edges of A are counted
+#define TACH_STEPS_PER_REV 720
+
+/**
+ * Initialize Timer A3 to capture both edges of the encoders,
+ * ELA on P10.5/TA3CCP1 (left) and ERA on P10.4/TA3CCP0 (right),
+ * with ELB on P5.2 and ERB on P5.0 giving the direction
+ *
+ * @param  none
+ * @return none
+ * @note   Assumes Clock_Init48MHz has been called (SMCLK=12MHz)
+ * @brief  Initialize the tachometers
+ */
+void Tachometer_Init(void);
+
+/**
+ * Get the latest tachometer measurements
+ *
+ * @param  leftPeriod is the time between the last two left rising edges in 1/3MHz units
+ * @param  leftEdges is the number of left edges since Tachometer_Init
+ * @param  rightPeriod is the time between the last two right rising edges in 1/3MHz units
+ * @param  rightEdges is the number of right edges since Tachometer_Init
+ * @return none
+ * @note   A period is 0 once the wheel has had no edge for a whole
+ *         Timer A3 rollover (21.8ms)
+ * @brief  Read the tachometers
+ */
+void Tachometer_Get(uint16_t *leftPeriod, uint32_t *leftEdges,
+                    uint16_t *rightPeriod, uint32_t *rightEdges);
+
+/**
+ * Get the signed wheel positions
+ *
+ * @param  leftSteps is the left wheel position, TACH_STEPS_PER_REV per revolution
+ * @param  rightSteps is the right wheel position, TACH_STEPS_PER_REV per revolution
+ * @return none
+ * @note   Forward is positive, both counts start at 0 in Tachometer_Init
+ * @brief  Read the encoder counts
+ */
+void Tachometer_GetSteps(int32_t *leftSteps, int32_t *rightSteps);
+
+/**
+ * Get the signed wheel speeds
+ *
+ * @param  leftRpm is the left wheel speed in rpm, forward is positive
+ * @param  rightRpm is the right wheel speed in rpm, forward is positive
+ * @return none
+ * @brief  Read the encoder velocities
+ */
+void Tachometer_GetSpeed(int16_t *leftRpm, int16_t *rightRpm);
+
+/**
+ * Measure the highest encoder edge rate the CPU can keep up with
+ *
+ * @param  none
+ * @return edges per second at the present clock
+ * @note   Makes 1000 edges on the right channel by switching its capture
+ *         input between GND and VCC, so the wheel must stand still.
+ *         Needs Tachometer_Init, TimeBase_Init and interrupts enabled.
+ *         Runs for about 1000 edge times.
+ * @brief  Benchmark the encoder interrupt
+ */
+uint32_t Tachometer_EdgeRate(void);
+
+#endif
@@ -0,0 +1,155 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        TimeBase.c
+// Function:    64-bit monotonic time base and sleeping delays using Timer32
+
+// Timer32 module 1 counts down from 0xFFFFFFFF at the bus clock forever.
+// Its interrupt adds one to the upper 32 bits every time it wraps
+// (every 89 s at 48 MHz), which gives a 64-bit cycle counter.
+// Timer32 module 2 is a one-shot alarm used to wake the CPU from WFI
+// when a deadline is reached, so a delay no longer polls a counter
+// and SysTick is left free (e.g. for the FreeRTOS tick).
+
+#include <stdint.h>
+#include "msp.h"
+#include "CortexM.h"
+#include "TimeBase.h"
+
+extern uint32_t ClockFrequency;     // cycles/second, see Clock.c
+
+static volatile uint32_t TimeHigh;  // upper 32 bits of the time base
+static uint32_t CyclesPerUs;        // bus cycles in 1us
+static uint64_t BaseCycles;         // time base when the clock last changed
+static uint64_t BaseUs;             // TimeBase_NowUs at that moment
+
+void TimeBase_Init(void){
+  TimeHigh = 0;
+  BaseCycles = BaseUs = 0;
+  CyclesPerUs = ClockFrequency/1000000;
+  TIMER32_1->CONTROL = 0;           // disable while configuring
+  TIMER32_1->LOAD = 0xFFFFFFFF;     // free running, full 32-bit range
+  TIMER32_1->INTCLR = 0;            // any write clears the interrupt
+  TIMER32_1->CONTROL = 0x000000E2;  // enable, periodic, interrupt, 32-bit, divide by 1
+  TIMER32_2->CONTROL = 0x00000023;  // alarm: stopped, interrupt, 32-bit, one-shot
+  TIMER32_2->INTCLR = 0;
+  // priority 1 on both Timer32 modules (IP is byte wide, one entry per interrupt)
+  NVIC->IP[25] = 0x20;
+  NVIC->IP[26] = 0x20;
+  // enable interrupts 25 and 26 in NVIC on Timer32
+  NVIC->ISER[0] = 0x06000000;
+}
+
+uint64_t TimeBase_Now(void){
+  uint32_t high, low;
+  long sr;
+  sr = StartCritical();
+  high = TimeHigh;
+  low = ~TIMER32_1->VALUE;          // counts down, invert to count up
+  if(TIMER32_1->RIS&0x01){          // wrapped but the ISR has not run yet
+    low = ~TIMER32_1->VALUE;        // read again after the wrap
+    if(low < 0x80000000){
+      high = high + 1;              // this reading is after the wrap
+    }
+  }
+  EndCritical(sr);
+  return ((uint64_t)high<<32)|low;
+}
+
+// The counter keeps running through a clock change, only the rate at
+// which it counts changes.  The microseconds before the change are kept
+// in BaseUs so TimeBase_NowUs never goes backwards.
+void TimeBase_SetClock(void){
+  long sr;
+  sr = StartCritical();
+  BaseUs = BaseUs + (TimeBase_Now() - BaseCycles)/CyclesPerUs;
+  BaseCycles = TimeBase_Now();
+  CyclesPerUs = ClockFrequency/1000000;
+  EndCritical(sr);
+}
+
+uint64_t TimeBase_NowUs(void){
+  uint64_t now, us;
+  long sr;
+  sr = StartCritical();
+  now = TimeBase_Now();
+  us = BaseUs + (now - BaseCycles)/CyclesPerUs;
+  EndCritical(sr);
+  return us;
+}
+
+void TimeBase_WaitUntil(uint64_t deadline){
+  uint64_t now;
+  uint64_t left;
+  long sr;
+  now = TimeBase_Now();
+  while(now < deadline){
+    left = deadline - now;
+    if(left > 0xFFFFFFFF){
+      left = 0xFFFFFFFF;            // the Timer32 wrap wakes us up anyway
+    }
+    // with I=1 the alarm cannot be serviced before WFI, it stays pending
+    // and wakes WFI instead, so a short alarm is never missed
+    sr = StartCritical();
+    TIMER32_2->CONTROL &= ~0x80;    // stop the alarm
+    TIMER32_2->LOAD = (uint32_t)left;
+    TIMER32_2->CONTROL |= 0x80;     // start the alarm
+    WaitForInterrupt();             // sleep until the alarm or another interrupt
+    EndCritical(sr);                // pending interrupts run here
+    now = TimeBase_Now();
+  }
+}
+
+void TimeBase_Wait1us(uint32_t us){
+  TimeBase_WaitUntil(TimeBase_Now() + (uint64_t)us*CyclesPerUs);
+}
+void TimeBase_Spin1us(uint32_t us){
+  uint64_t deadline;
+  deadline = TimeBase_Now() + (uint64_t)us*CyclesPerUs;
+  while(TimeBase_Now() < deadline){
+  }
+}
+
+void TimeBase_Wait1ms(uint32_t ms){
+  TimeBase_WaitUntil(TimeBase_Now() + (uint64_t)ms*CyclesPerUs*1000);
+}
+
+// Timer32 module 1 wrapped: extend the counter
+void T32_INT1_IRQHandler(void){
+  TIMER32_1->INTCLR = 0;            // acknowledge
+  TimeHigh = TimeHigh + 1;
+}
+
+// Timer32 module 2 alarm: nothing to do, the wait loop rechecks the time
+void T32_INT2_IRQHandler(void){
+  TIMER32_2->INTCLR = 0;            // acknowledge
+}
@@ -0,0 +1,124 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        TimeBase.h
+// Function:    header file of TimeBase.c
+
+#ifndef TIMEBASE_H_
+#define TIMEBASE_H_
+
+/**
+ * Start the free-running 64-bit time base on Timer32
+ *
+ * @param  none
+ * @return none
+ * @note   Uses both Timer32 modules and their interrupts (priority 1).
+ *         Call once, it resets the time to 0.  After a later clock
+ *         change call TimeBase_SetClock instead.
+ * @brief  Initialize the time base
+ */
+void TimeBase_Init(void);
+
+/**
+ * Follow a change of the bus clock
+ *
+ * @param  none
+ * @return none
+ * @note   Call after ClockFrequency has changed, e.g. after
+ *         Clock_Init48MHz.  The time base keeps counting, so TimeBase_Now
+ *         and TimeBase_NowUs stay monotonic, and the delays use the new
+ *         clock from now on.
+ * @brief  Update the time base for a new clock
+ */
+void TimeBase_SetClock(void);
+
+/**
+ * Read the time base in bus cycles
+ *
+ * @param  none
+ * @return bus cycles since TimeBase_Init, never wraps in practice
+ * @note   Safe to call from any ISR and with interrupts disabled
+ * @brief  Current time in bus cycles
+ */
+uint64_t TimeBase_Now(void);
+
+/**
+ * Read the time base in microseconds
+ *
+ * @param  none
+ * @return microseconds since TimeBase_Init
+ * @note   Derived from ClockFrequency, see Clock.c and TimeBase_SetClock
+ * @brief  Current time in us
+ */
+uint64_t TimeBase_NowUs(void);
+
+/**
+ * Sleep in WFI until the time base reaches a deadline
+ *
+ * @param  deadline is an absolute time in bus cycles, see TimeBase_Now
+ * @return none
+ * @note   Returns right away if the deadline has already passed.
+ *         Other interrupts keep running while waiting.
+ * @brief  Wait for an absolute deadline
+ */
+void TimeBase_WaitUntil(uint64_t deadline);
+
+/**
+ * Sleep for a number of microseconds
+ *
+ * @param  us is the time to wait in microseconds
+ * @return none
+ * @brief  Time delay using the time base
+ */
+void TimeBase_Wait1us(uint32_t us);
+
+/**
+ * Busy-wait for a number of microseconds
+ *
+ * @param  us is the time to wait in microseconds
+ * @return none
+ * @note   Polls TimeBase_Now, no WFI and no Timer32 alarm, so it is
+ *         safe in an ISR.  For short delays only.
+ * @brief  Time delay for ISRs using the time base
+ */
+void TimeBase_Spin1us(uint32_t us);
+
+/**
+ * Sleep for a number of milliseconds
+ *
+ * @param  ms is the time to wait in milliseconds
+ * @return none
+ * @brief  Time delay using the time base
+ */
+void TimeBase_Wait1ms(uint32_t ms);
+
+#endif
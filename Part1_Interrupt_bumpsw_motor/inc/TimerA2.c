@@ -0,0 +1,68 @@
+/*
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        TimerA2.c
+// Function:    Periodic interrupt using Timer A2
+
+#include <stdint.h>
+#include "msp.h"
+
+void (*TimerA2Task)(void);   // user function
+
+// Activate Timer A2 interrupts to run user task periodically
+// Input: task is a pointer to a user function
+//        period in units (4/SMCLK), 16 bits
+// Output: none
+// With SMCLK 12 MHz, period = 3000 gives 1ms
+void TimerA2_Init(void(*task)(void), uint16_t period){
+  TimerA2Task = task;             // user function
+  TIMER_A2->CTL = 0x0280;         // SMCLK, divide by 4, halted
+  TIMER_A2->CCTL[0] = 0x0010;     // compare mode, arm CCIFG0
+  TIMER_A2->CCR[0] = (period - 1);// compare match value
+  TIMER_A2->EX0 = 0x0000;         // configure for input clock divider /1
+  // priority 2 on Timer A2 CCR0 (IP is byte wide, one entry per interrupt)
+  NVIC->IP[12] = 0x40;
+  // enable interrupt 12 in NVIC on Timer A2 CCR0
+  NVIC->ISER[0] = 0x00001000;
+  TIMER_A2->CTL |= 0x0014;        // reset and start Timer A2 in up mode
+}
+
+// Stop Timer A2
+void TimerA2_Stop(void){
+  TIMER_A2->CTL &= ~0x0030;       // halted (stop mode)
+  NVIC->ICER[0] = 0x00001000;     // disable interrupt 12 in NVIC
+}
+
+void TA2_0_IRQHandler(void){
+  TIMER_A2->CCTL[0] &= ~0x0001;   // acknowledge capture/compare interrupt 0
+  (*TimerA2Task)();               // execute user task
+}
@@ -47,6 +47,12 @@ policies, either expressed or implied, of the FreeBSD Project.
 #include <stdint.h>
 #include "msp.h"
 #include "SysTick.h"
+#include "CortexM.h"
+#include "TimeBase.h"
+#include "PWM.h"
+#include "motor.h"
+
+extern uint32_t ClockFrequency;     // cycles/second, see Clock.c
 
 // *******Lab 12 *******
 
@@ -57,6 +63,10 @@ void Motor_InitSimple(void){
     P1->SEL1 &= ~0xD2;        // configure as GPIO
     P1->DIR |= 0x00;          // Motor Forward which is in Module 12.2
     P1->OUT |= 0xD2;          // P1.4 and P1.1 are pull-up
+    P3->SEL0 &= ~0xC0;
+    P3->SEL1 &= ~0xC0;        // configure P3.6 and P3.7 (nSLP) as GPIO
+    P3->DIR |= 0xC0;          // make P3.6 and P3.7 out
+    P3->OUT &= ~0xC0;         // drivers asleep until the first move
 }
 
 void Motor_StopSimple(uint32_t time_ms){
@@ -64,6 +74,7 @@ void Motor_StopSimple(uint32_t time_ms){
 // Returns right away
   P1->OUT &= ~0xC0;   // off
   P2->OUT &= ~0xC0;   // off
+  P3->OUT &= ~0xC0;   // low current sleep mode
   SysTick_Wait10ms(time_ms); // wait for multiple of 10ms from SysTick
 }
 
@@ -74,6 +85,7 @@ void Motor_ForwardSimple(uint16_t duty, uint32_t time_ms){
 
 	// The PWM has high (H) and low (L) cycle.
     L = 1000-duty; // PWM using H and L
+    P3->OUT |= 0xC0;  // wake up both drivers (nSLP high)
 	
 	/*
 	  Section: mtr_dir_fwd
@@ -120,6 +132,7 @@ void Motor_BackwardSimple(uint16_t duty, uint32_t time_ms){
 
 	// The PWM has high (H) and low (L) cycle.
     L = 1000-duty; // PWM using H and L
+    P3->OUT |= 0xC0;  // wake up both drivers (nSLP high)
 		
 	
 	/*
@@ -167,6 +180,7 @@ void Motor_LeftSimple(uint16_t duty, uint32_t time_ms){
 
 	// The PWM has high (H) and low (L) cycle.
     L = 1000-duty; // PWM using H and L
+    P3->OUT |= 0xC0;  // wake up both drivers (nSLP high)
 	
 	/*
 	  Section: mtr_dir_lft
@@ -212,6 +226,7 @@ void Motor_RightSimple(uint16_t duty, uint32_t time_ms){
 
 	// The PWM has high (H) and low (L) cycle.
     L = 1000-duty; // PWM using H and L
+    P3->OUT |= 0xC0;  // wake up both drivers (nSLP high)
 	
 	/*
 	  Section: mtr_dir_rgt
@@ -250,3 +265,170 @@ void Motor_RightSimple(uint16_t duty, uint32_t time_ms){
 	  // (4) wait for 1ms using SysTick_Wait
 	
 }
+
+// *******Hardware PWM *******
+// The functions below use Timer A0 (see PWM.c) to generate the PWM,
+// so they only change the direction and the compare registers
+// and return right away.  The motors keep running at the given duty
+// until the next call, the CPU is free to do other work meanwhile.
+// Each DRV8838 is put to sleep (nSLP low) once its motor has been
+// stopped for the sleep timeout, and is woken by the next command that
+// moves it.  A wake-up waits MOTOR_WAKE_US before the PWM is changed.
+
+// Bit-band aliases, one store changes one pin and nothing else on the
+// port, so an ISR can never undo a main program write to P1.0 (REDLED)
+// or the other way round
+#define DIRL    BITBAND_PERI(P1->OUT, 7)    // 0x4209805C
+#define DIRR    BITBAND_PERI(P1->OUT, 6)    // 0x42098058
+#define NSLPL   BITBAND_PERI(P3->OUT, 7)    // 0x4209845C
+#define NSLPR   BITBAND_PERI(P3->OUT, 6)    // 0x42098458
+
+typedef struct {
+  uint8_t  awake;
+  uint64_t lastMove;      // time of the last command with a nonzero duty
+  uint64_t sleepStart;    // time the driver went to sleep
+  uint64_t sleepCycles;   // time asleep, not counting the present sleep
+} MotorPower_t;
+
+static MotorPower_t PowerL, PowerR;
+static uint64_t SleepTimeout;   // bus cycles, 0 never sleeps
+
+// Note a command that moves the motor, wake its driver if needed.
+// Returns 1 if the driver was asleep
+static int Motor_Wake(MotorPower_t *p, volatile uint8_t *nslp, uint64_t now){
+    p->lastMove = now;
+    if(p->awake) return 0;
+    *nslp = 1;
+    p->awake = 1;
+    p->sleepCycles += now - p->sleepStart;
+    return 1;
+}
+
+// Put the driver to sleep if its motor has been stopped long enough
+static void Motor_Doze(MotorPower_t *p, volatile uint8_t *nslp, uint16_t duty, uint64_t now){
+    if(p->awake && (duty == 0) && (now - p->lastMove >= SleepTimeout)){
+        *nslp = 0;
+        p->awake = 0;
+        p->sleepStart = now;
+    }
+}
+
+// Wake the drivers of the motors about to move, left and right are duties.
+// Called from main and from the motion and speed control ISRs: the state
+// is updated in a critical section and the wake-up time is a busy-wait,
+// TimeBase_Wait1us would sleep in WFI and take over Timer32 2
+static void Motor_Power(uint16_t left, uint16_t right){
+    uint64_t now;
+    int woken = 0;
+    long sr;
+    if((left == 0) && (right == 0)) return;
+    sr = StartCritical();
+    now = TimeBase_Now();
+    if(left) woken |= Motor_Wake(&PowerL, &NSLPL, now);
+    if(right) woken |= Motor_Wake(&PowerR, &NSLPR, now);
+    EndCritical(sr);
+    if(woken) TimeBase_Spin1us(MOTOR_WAKE_US);
+}
+
+void Motor_Init(void){
+    // initialise P1.6, P1.7 (direction) and P3.6, P3.7 (nSLP) as outputs
+    // and start Timer A0 PWM on P2.6, P2.7 with both motors stopped
+    // Needs TimeBase_Init (SysTick_Init) for the sleep timer
+    // Returns right away
+    long sr;
+    P1->SEL0 &= ~0xC0;
+    P1->SEL1 &= ~0xC0;        // configure P1.6 and P1.7 as GPIO
+    P1->DIR |= 0xC0;          // make P1.6 and P1.7 out
+    P1->OUT |= 0xC0;          // direction is forward
+    P3->SEL0 &= ~0xC0;
+    P3->SEL1 &= ~0xC0;        // configure P3.6 and P3.7 as GPIO
+    P3->DIR |= 0xC0;          // make P3.6 and P3.7 out
+    P3->OUT |= 0xC0;          // wake up both motor drivers
+    sr = StartCritical();
+    PowerL.awake = PowerR.awake = 1;
+    PowerL.lastMove = PowerR.lastMove = TimeBase_Now();
+    PowerL.sleepCycles = PowerR.sleepCycles = 0;
+    EndCritical(sr);
+    Motor_SetSleepTimeout(MOTOR_SLEEP_MS);
+    PWM_Init34(MOTOR_PERIOD, 0, 0);
+}
+
+void Motor_SetDirection(uint8_t dir){
+// Set the direction of both motors, dir is one of
+// MOTOR_FORWARD, MOTOR_BACKWARD, MOTOR_LEFT or MOTOR_RIGHT
+// Returns right away
+    DIRL = (dir>>7)&1;
+    DIRR = (dir>>6)&1;
+}
+
+void Motor_SetDuty(uint16_t leftDuty, uint16_t rightDuty){
+// Set the duty of both motors, 0 (stop) to MOTOR_PERIOD (full speed)
+// Returns right away, 30us later (busy-wait) if a driver had to be woken up
+    if(leftDuty >= MOTOR_PERIOD) leftDuty = MOTOR_PERIOD-1;
+    if(rightDuty >= MOTOR_PERIOD) rightDuty = MOTOR_PERIOD-1;
+    Motor_Power(leftDuty, rightDuty);
+    PWM_Duty4(leftDuty);      // left motor on P2.7
+    PWM_Duty3(rightDuty);     // right motor on P2.6
+}
+
+void Motor_Stop(void){
+// Stops both motors, the drivers sleep after the sleep timeout
+// Returns right away
+    PWM_Duty3(0);
+    PWM_Duty4(0);
+}
+
+void Motor_Set(int16_t left, int16_t right){
+// Set the speed and direction of both motors, -MOTOR_PERIOD (full
+// backward) to MOTOR_PERIOD (full forward), 0 stops the motor.
+// Everything is worked out first and then written with one store per
+// pin or compare register
+// Returns right away, 30us later (busy-wait) if a driver had to be woken up
+    uint8_t dirL = 1, dirR = 1;
+    uint16_t dutyL, dutyR;    // magnitude, -32768 does not fit an int16_t
+    if(left < 0){ dutyL = -(int32_t)left; dirL = 0; }else{ dutyL = left; }
+    if(right < 0){ dutyR = -(int32_t)right; dirR = 0; }else{ dutyR = right; }
+    if(dutyL >= MOTOR_PERIOD) dutyL = MOTOR_PERIOD-1;
+    if(dutyR >= MOTOR_PERIOD) dutyR = MOTOR_PERIOD-1;
+    Motor_Power(dutyL, dutyR);
+    DIRL = dirL;
+    DIRR = dirR;
+    TIMER_A0->CCR[4] = dutyL; // left motor on P2.7
+    TIMER_A0->CCR[3] = dutyR; // right motor on P2.6
+}
+
+void Motor_SetSleepTimeout(uint32_t ms){
+// Set how long a motor must be stopped before its driver sleeps,
+// 0 keeps the drivers awake
+    long sr;
+    sr = StartCritical();
+    SleepTimeout = (uint64_t)ms*(ClockFrequency/1000);
+    EndCritical(sr);
+}
+
+void Motor_PowerTick(void){
+// Sleep the drivers of motors that have been stopped long enough,
+// call every few ms, e.g. from the motion tick
+    uint64_t now;
+    long sr;
+    sr = StartCritical();
+    if(SleepTimeout){
+        now = TimeBase_Now();
+        Motor_Doze(&PowerL, &NSLPL, TIMER_A0->CCR[4], now);
+        Motor_Doze(&PowerR, &NSLPR, TIMER_A0->CCR[3], now);
+    }
+    EndCritical(sr);
+}
+
+void Motor_GetSleepTime(uint32_t *leftMs, uint32_t *rightMs){
+// Total time each driver has spent asleep since Motor_Init
+    uint64_t now, left, right;
+    long sr;
+    sr = StartCritical();
+    now = TimeBase_Now();
+    left = PowerL.sleepCycles + (PowerL.awake ? 0 : now - PowerL.sleepStart);
+    right = PowerR.sleepCycles + (PowerR.awake ? 0 : now - PowerR.sleepStart);
+    EndCritical(sr);
+    *leftMs = (uint32_t)(left/(ClockFrequency/1000));
+    *rightMs = (uint32_t)(right/(ClockFrequency/1000));
+}
@@ -43,4 +43,28 @@ void Motor_BackwardSimple(uint16_t duty, uint32_t time_ms);
 void Motor_LeftSimple(uint16_t duty, uint32_t time_ms);
 void Motor_RightSimple(uint16_t duty, uint32_t time_ms);
 
+// Hardware PWM (Timer A0), duty is from 0 to MOTOR_PERIOD
+#define MOTOR_PERIOD    1000
+
+// Direction of the motors, written to P1.7 (left) and P1.6 (right)
+// '1' = forward, '0' = backward
+#define MOTOR_FORWARD   0xC0
+#define MOTOR_BACKWARD  0x00
+#define MOTOR_LEFT      0x40    // left backward, right forward
+#define MOTOR_RIGHT     0x80    // left forward, right backward
+
+// Driver power, a stopped motor's DRV8838 sleeps after MOTOR_SLEEP_MS
+// and needs MOTOR_WAKE_US to wake up (nSLP high to outputs valid)
+#define MOTOR_SLEEP_MS  1000
+#define MOTOR_WAKE_US   30
+
+void Motor_Init(void);
+void Motor_SetDirection(uint8_t dir);
+void Motor_SetDuty(uint16_t leftDuty, uint16_t rightDuty);
+void Motor_Stop(void);
+void Motor_Set(int16_t left, int16_t right);
+void Motor_SetSleepTimeout(uint32_t ms);
+void Motor_PowerTick(void);
+void Motor_GetSleepTime(uint32_t *leftMs, uint32_t *rightMs);
+
 #endif
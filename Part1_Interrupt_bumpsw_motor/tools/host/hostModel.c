@@ -0,0 +1,124 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        hostModel.c
+// Function:    Registers, bit-band and core functions of the host model
+//
+// Replaces CortexM.c, Clock.c and TimeBase.c for the host tests: the
+// critical sections only track PRIMASK, and time is a counter that the
+// waits and the tests move forward, so a test runs in no real time.
+
+#include <stdint.h>
+#include <string.h>
+#include "msp.h"
+#include "hostModel.h"
+#include "CortexM.h"
+#include "TimeBase.h"
+
+DIO_PORT_Interruptable_Type Host_P[11];
+Timer_A_Type Host_TimerA[4];
+Timer32_Type Host_Timer32[2];
+NVIC_Type Host_NVIC;
+SysTick_Type Host_SysTick;
+SCB_Type Host_SCB;
+
+uint32_t ClockFrequency = 48000000;
+uint64_t Host_Now;
+uint32_t Host_Wfi;
+uint32_t Host_TimedWaits;
+uint32_t Host_Spins;
+long Host_IBit;
+int Host_Failures;
+
+// One bit-band alias word that has been handed out
+typedef struct {
+  volatile uint8_t *reg;
+  int bit;
+  volatile uint8_t value;   // what the driver sees and stores
+  uint8_t loaded;           // value when handed out
+} BitBandCell_t;
+
+#define HOST_CELLS 8
+static BitBandCell_t Cells[HOST_CELLS];
+static int NextCell;
+
+void Host_BitBandFlush(void){
+  int i;
+  for(i = 0; i < HOST_CELLS; i++){
+    BitBandCell_t *c = &Cells[i];
+    if(c->reg && (c->value != c->loaded)){
+      if(c->value&1){
+        *c->reg |= (uint8_t)(1<<c->bit);
+      }else{
+        *c->reg &= (uint8_t)~(1<<c->bit);
+      }
+      c->loaded = c->value;
+    }
+  }
+}
+
+volatile uint8_t *Host_BitBand(volatile uint8_t *reg, int bit){
+  BitBandCell_t *c;
+  Host_BitBandFlush();
+  c = &Cells[NextCell];
+  NextCell = (NextCell + 1)%HOST_CELLS;
+  c->reg = reg;
+  c->bit = bit;
+  c->loaded = c->value = (*reg>>bit)&1;
+  return &c->value;
+}
+
+void Host_Reset(void){
+  memset(Host_P, 0, sizeof(Host_P));
+  memset(Host_TimerA, 0, sizeof(Host_TimerA));
+  memset(Host_Timer32, 0, sizeof(Host_Timer32));
+  memset(&Host_NVIC, 0, sizeof(Host_NVIC));
+  memset(&Host_SysTick, 0, sizeof(Host_SysTick));
+  memset(&Host_SCB, 0, sizeof(Host_SCB));
+  memset(Cells, 0, sizeof(Cells));
+  NextCell = 0;
+  Host_Now = 0;
+  Host_Wfi = Host_TimedWaits = Host_Spins = 0;
+  Host_IBit = 0;
+}
+
+int Host_Result(const char *name){
+  printf("%s: %s\n", name, Host_Failures ? "FAILED" : "ok");
+  return Host_Failures != 0;
+}
+
+// CortexM.c
+void DisableInterrupts(void){ Host_IBit = 1; }
+void EnableInterrupts(void){ Host_IBit = 0; }
+long StartCritical(void){
+  long sr = Host_IBit;
+  Host_IBit = 1;
+  return sr;
+}
+void EndCritical(long sr){ Host_IBit = sr; }
+void WaitForInterrupt(void){ Host_Wfi++; }
+
+// Clock.c
+uint32_t Clock_GetFreq(void){ return ClockFrequency; }
+
+// TimeBase.c
+void TimeBase_Init(void){ Host_Now = 0; }
+uint64_t TimeBase_Now(void){ return Host_Now; }
+uint64_t TimeBase_NowUs(void){ return Host_Now/(ClockFrequency/1000000); }
+void TimeBase_WaitUntil(uint64_t deadline){
+  Host_TimedWaits++;
+  Host_Wfi++;
+  if(deadline > Host_Now) Host_Now = deadline;
+}
+void TimeBase_Wait1us(uint32_t us){
+  TimeBase_WaitUntil(Host_Now + (uint64_t)us*(ClockFrequency/1000000));
+}
+void TimeBase_Spin1us(uint32_t us){
+  Host_Spins++;
+  Host_Now += (uint64_t)us*(ClockFrequency/1000000);
+}
+void TimeBase_Wait1ms(uint32_t ms){
+  TimeBase_WaitUntil(Host_Now + (uint64_t)ms*(ClockFrequency/1000));
+}
+
+// SysTick.c
+void SysTick_Wait10ms(uint32_t delay){ TimeBase_Wait1ms(10*delay); }
@@ -0,0 +1,46 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        hostModel.h
+// Function:    header file of hostModel.c
+
+#ifndef HOSTMODEL_H_
+#define HOSTMODEL_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+// Simulated time base, bus cycles at ClockFrequency (48 MHz)
+extern uint64_t Host_Now;
+extern uint32_t Host_Wfi;           // calls of WaitForInterrupt
+extern uint32_t Host_TimedWaits;    // calls of the sleeping TimeBase waits
+extern uint32_t Host_Spins;         // calls of TimeBase_Spin1us
+extern long Host_IBit;              // PRIMASK, 1 inside StartCritical/EndCritical
+
+/**
+ * Clear every register, the bit-band cells and the simulated time
+ *
+ * @param  none
+ * @return none
+ * @brief  Power-on reset of the model
+ */
+void Host_Reset(void);
+
+/**
+ * Write back the bit-band stores made since the last access
+ *
+ * @param  none
+ * @return none
+ * @note   A store through BITBAND_PERI lands in a cell that is folded into
+ *         its register on the next bit-band access or on this call.  Call
+ *         it before checking a port a driver wrote through bit-band.
+ * @brief  Complete pending bit-band stores
+ */
+void Host_BitBandFlush(void);
+
+// Test bookkeeping: CHECK counts and prints failures, main returns Host_Result
+extern int Host_Failures;
+#define CHECK(cond) do{ if(!(cond)){ Host_Failures++; \
+    printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); } }while(0)
+int Host_Result(const char *name);
+
+#endif
@@ -0,0 +1,117 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        msp.h
+// Function:    Host register model of the MSP432 peripherals used by inc/
+//
+// Stands in for the device msp.h when the drivers in ../../inc are built
+// with the host compiler for the tests in ../.  Each peripheral is a plain
+// struct in RAM (hostModel.c) with the register names of the device
+// header, so a driver writes it exactly as it writes the hardware and a
+// test reads it back.  Nothing happens on its own: a register that the
+// hardware changes (IN, IV, CCR in capture mode, ...) is set by the test.
+//
+// Bit-band stores go through Host_BitBand, see hostModel.h.
+
+#ifndef HOST_MSP_H_
+#define HOST_MSP_H_
+
+#include <stdint.h>
+
+// Read-only registers stay writable here so a test can drive them
+#define __I     volatile
+#define __O     volatile
+#define __IO    volatile
+
+// Digital I/O port, 8-bit view as in DIO_PORT_Odd/Even_Interruptable_Type
+typedef struct {
+  __I  uint8_t  IN;
+  __IO uint8_t  OUT;
+  __IO uint8_t  DIR;
+  __IO uint8_t  REN;
+  __IO uint8_t  DS;
+  __IO uint8_t  SEL0;
+  __IO uint8_t  SEL1;
+  __IO uint8_t  SELC;
+  __IO uint8_t  IES;
+  __IO uint8_t  IE;
+  __IO uint8_t  IFG;
+  __I  uint16_t IV;
+} DIO_PORT_Interruptable_Type;
+
+typedef struct {
+  __IO uint16_t CTL;
+  __IO uint16_t CCTL[7];
+  __IO uint16_t R;
+  __IO uint16_t CCR[7];
+  __IO uint16_t EX0;
+  __I  uint16_t IV;
+} Timer_A_Type;
+
+typedef struct {
+  __IO uint32_t LOAD;
+  __I  uint32_t VALUE;
+  __IO uint32_t CONTROL;
+  __O  uint32_t INTCLR;
+  __I  uint32_t RIS;
+  __I  uint32_t MIS;
+  __IO uint32_t BGLOAD;
+} Timer32_Type;
+
+typedef struct {
+  __IO uint32_t ISER[8];
+  __IO uint32_t ICER[8];
+  __IO uint32_t ISPR[8];
+  __IO uint32_t ICPR[8];
+  __IO uint8_t  IP[240];
+} NVIC_Type;
+
+typedef struct {
+  __IO uint32_t CTRL;
+  __IO uint32_t LOAD;
+  __IO uint32_t VAL;
+} SysTick_Type;
+
+typedef struct {
+  __IO uint32_t SCR;
+  __IO uint8_t  SHP[12];
+} SCB_Type;
+
+extern DIO_PORT_Interruptable_Type Host_P[11];
+extern Timer_A_Type Host_TimerA[4];
+extern Timer32_Type Host_Timer32[2];
+extern NVIC_Type Host_NVIC;
+extern SysTick_Type Host_SysTick;
+extern SCB_Type Host_SCB;
+
+#define P1          (&Host_P[1])
+#define P2          (&Host_P[2])
+#define P3          (&Host_P[3])
+#define P4          (&Host_P[4])
+#define P5          (&Host_P[5])
+#define P6          (&Host_P[6])
+#define P7          (&Host_P[7])
+#define P8          (&Host_P[8])
+#define P9          (&Host_P[9])
+#define P10         (&Host_P[10])
+#define TIMER_A0    (&Host_TimerA[0])
+#define TIMER_A1    (&Host_TimerA[1])
+#define TIMER_A2    (&Host_TimerA[2])
+#define TIMER_A3    (&Host_TimerA[3])
+#define TIMER32_1   (&Host_Timer32[0])
+#define TIMER32_2   (&Host_Timer32[1])
+#define NVIC        (&Host_NVIC)
+#define SysTick     (&Host_SysTick)
+#define SCB         (&Host_SCB)
+
+// Bit-band alias of bit b of peripheral register x, as in msp432p401r.h
+volatile uint8_t *Host_BitBand(volatile uint8_t *reg, int bit);
+#define BITBAND_PERI(x, b)  (*Host_BitBand((volatile uint8_t *)&(x), (b)))
+
+// Cortex-M4 intrinsics used by the drivers, in portable C
+static inline uint32_t __SMLAD(uint32_t x, uint32_t y, uint32_t acc){
+  return (uint32_t)((int32_t)acc + (int16_t)x*(int16_t)y
+                    + (int16_t)(x>>16)*(int16_t)(y>>16));
+}
+#define __DSB()     __sync_synchronize()
+
+#endif
@@ -0,0 +1,169 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        test_debounce.c
+// Function:    Replay bounce traces through Debounce.c on the host
+//
+// Each trace is one P4 sample per Timer A2 tick (1ms), negative logic as
+// Bump_Read_Input returns it.  The samples go through the real Timer A2
+// ISR, so the test also covers TimerA2.c.  A trace lists the debounced
+// edges it must produce, with the tick they must appear on.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "msp.h"
+#include "hostModel.h"
+#include "Debounce.h"
+
+void TA2_0_IRQHandler(void);
+
+#define BUMP_MASK 0xED
+
+typedef struct {
+  uint32_t tick;
+  uint8_t  pressed;
+  uint8_t  released;
+} Edge_t;
+
+static const uint8_t *Trace;
+static uint32_t Tick;
+#define MAX_EDGES 2048
+static Edge_t Edges[MAX_EDGES];
+static uint32_t NumEdges;
+
+static uint8_t ReadTrace(void){
+  return Trace[Tick];
+}
+
+static void RecordEdge(uint8_t pressed, uint8_t released){
+  if(NumEdges < MAX_EDGES){
+    Edges[NumEdges].tick = Tick;
+    Edges[NumEdges].pressed = pressed;
+    Edges[NumEdges].released = released;
+  }
+  NumEdges++;
+}
+
+static void Replay(const uint8_t *trace, uint32_t n, uint8_t samples){
+  Host_Reset();
+  Trace = trace;
+  Tick = 0;
+  NumEdges = 0;
+  Debounce_Init(&ReadTrace, &RecordEdge, BUMP_MASK, 3000, samples);
+  for(Tick = 1; Tick < n; Tick++){
+    TA2_0_IRQHandler();
+  }
+}
+
+// Bump 0 (P4.0) closes with 4ms of bounce, stays closed, then opens
+// with 3ms of bounce
+static const uint8_t PressRelease[] = {
+  0xED, 0xED, 0xEC, 0xED, 0xEC, 0xEC, 0xED, 0xEC,   // bounce, closed from 7
+  0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC,
+  0xEC, 0xEC, 0xEC, 0xEC, 0xED, 0xEC, 0xED, 0xED,   // bounce, open from 22
+  0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED
+};
+
+static void test_press_release(void){
+  Replay(PressRelease, sizeof(PressRelease), 3);
+  CHECK(TIMER_A2->CCR[0] == 2999);        // 1ms sample period
+  CHECK(NumEdges == 2);
+  CHECK(Edges[0].pressed == 0x01 && Edges[0].released == 0);
+  CHECK(Edges[0].tick == 9);              // 3 equal samples after the last bounce
+  CHECK(Edges[1].pressed == 0 && Edges[1].released == 0x01);
+  CHECK(Edges[1].tick == 24);
+  CHECK(Debounce_State() == 0xED);
+}
+
+// Glitches up to samples-1 ticks long never reach the output
+static const uint8_t Glitches[] = {
+  0xED, 0xED, 0xEC, 0xED, 0xED, 0x6D, 0x6D, 0xED,
+  0xED, 0x25, 0xED, 0xED, 0x00, 0x00, 0xED, 0xED,
+  0xED, 0xED, 0xED, 0xED
+};
+
+static void test_glitches(void){
+  Replay(Glitches, sizeof(Glitches), 3);
+  CHECK(NumEdges == 0);
+  CHECK(Debounce_State() == 0xED);
+  Replay(Glitches, sizeof(Glitches), 1);  // no debouncing at all
+  CHECK(NumEdges == 8);
+}
+
+// Bits outside the mask (P4.1 and P4.4 are not switches) are ignored
+static const uint8_t Unmasked[] = {
+  0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xED, 0xED
+};
+
+static void test_mask(void){
+  Replay(Unmasked, sizeof(Unmasked), 2);
+  CHECK(NumEdges == 0);
+  CHECK((Debounce_State()&BUMP_MASK) == 0xED);
+}
+
+// All six switches bounce independently at once.  Each change of a switch
+// starts with a burst of runs shorter than the debounce count, which
+// ends on the old level, and is then held.  Every switch must give
+// exactly its real edges, each on the tick its new level has been seen
+// samples times in a row.
+#define RANDOM_TICKS 5000
+#define RANDOM_EDGES 512
+static uint8_t Random[RANDOM_TICKS];
+static uint32_t Want[8][RANDOM_EDGES];
+static uint32_t NumWant[8];
+
+static void test_random_bounce(uint8_t samples){
+  uint32_t t, i, n, run;
+  int bit, level, cur;
+  srand(12345 + samples);
+  for(t = 0; t < RANDOM_TICKS; t++) Random[t] = 0xED;
+  for(bit = 0; bit < 8; bit++){
+    NumWant[bit] = 0;
+    if(!((BUMP_MASK>>bit)&1)) continue;
+    level = 1;                            // released
+    t = 1 + rand()%50;
+    while(t + 300 < RANDOM_TICKS){
+      // bounce: alternate runs of 1 to samples-1 ticks, ending on the old level
+      n = rand()%6;
+      cur = !level;
+      for(i = 0; i < 2*n; i++){
+        for(run = 1 + rand()%(samples - 1); run; run--){
+          if(!cur) Random[t] &= (uint8_t)~(1<<bit);
+          t++;
+        }
+        cur = !cur;
+      }
+      level = !level;                     // then the new level is held
+      Want[bit][NumWant[bit]++] = t + samples - 1;
+      for(run = samples + rand()%200; run; run--){
+        if(!level) Random[t] &= (uint8_t)~(1<<bit);
+        t++;
+      }
+    }
+    for(; t < RANDOM_TICKS; t++){
+      if(!level) Random[t] &= (uint8_t)~(1<<bit);
+    }
+  }
+  Replay(Random, RANDOM_TICKS, samples);
+  for(bit = 0; bit < 8; bit++){
+    n = 0;
+    for(i = 0; i < NumEdges && i < MAX_EDGES; i++){
+      if(((Edges[i].pressed|Edges[i].released)>>bit)&1){
+        CHECK(n < NumWant[bit] && Edges[i].tick == Want[bit][n]);
+        n++;
+      }
+    }
+    CHECK(n == NumWant[bit]);
+  }
+  CHECK(NumEdges <= MAX_EDGES);
+  CHECK(Debounce_State() == Random[RANDOM_TICKS-1]);
+}
+
+int main(void){
+  test_press_release();
+  test_glitches();
+  test_mask();
+  test_random_bounce(2);
+  test_random_bounce(3);
+  test_random_bounce(DEBOUNCE_MAXSAMPLES);
+  return Host_Result("test_debounce");
+}
@@ -0,0 +1,167 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        test_motor.c
+// Function:    Host tests of PWM.c and the hardware PWM part of motor.c
+//
+// Checks the Timer A0 set-up, that duty and direction calls only touch
+// their own compare register or pin, the range checks, and the nSLP
+// sleep and wake-up of the drivers.
+
+#include <stdint.h>
+#include "msp.h"
+#include "hostModel.h"
+#include "PWM.h"
+#include "motor.h"
+
+static void test_pwm_init(void){
+  Host_Reset();
+  PWM_Init34(1000, 100, 200);
+  CHECK((P2->DIR&0xC0) == 0xC0);
+  CHECK((P2->SEL0&0xC0) == 0xC0);
+  CHECK((P2->SEL1&0xC0) == 0);
+  CHECK(TIMER_A0->CCR[0] == 1000);
+  CHECK(TIMER_A0->CCR[3] == 100);
+  CHECK(TIMER_A0->CCR[4] == 200);
+  CHECK(TIMER_A0->CCTL[3] == 0x0040);     // toggle/reset
+  CHECK(TIMER_A0->CCTL[4] == 0x0040);
+  CHECK(TIMER_A0->CTL == 0x0230);         // SMCLK, up-down mode
+  // a duty of a whole period or more is refused and changes nothing
+  Host_Reset();
+  PWM_Init34(1000, 1000, 0);
+  CHECK(TIMER_A0->CTL == 0);
+  CHECK(P2->DIR == 0);
+}
+
+static void test_pwm_duty(void){
+  Host_Reset();
+  PWM_Init34(1000, 0, 0);
+  PWM_Duty3(750);
+  CHECK(TIMER_A0->CCR[3] == 750);
+  CHECK(TIMER_A0->CCR[4] == 0);
+  PWM_Duty4(999);
+  CHECK(TIMER_A0->CCR[4] == 999);
+  CHECK(TIMER_A0->CCR[3] == 750);
+  PWM_Duty3(1000);                        // out of range, ignored
+  PWM_Duty4(65535);
+  CHECK(TIMER_A0->CCR[3] == 750);
+  CHECK(TIMER_A0->CCR[4] == 999);
+}
+
+static void test_motor_init(void){
+  Host_Reset();
+  P1->OUT = 0x01;                         // red LED on, must survive
+  Motor_Init();
+  Host_BitBandFlush();
+  CHECK((P1->DIR&0xC0) == 0xC0);
+  CHECK(P1->OUT == 0xC1);                 // forward, LED untouched
+  CHECK((P3->DIR&0xC0) == 0xC0);
+  CHECK((P3->OUT&0xC0) == 0xC0);          // both drivers awake
+  CHECK(TIMER_A0->CCR[0] == MOTOR_PERIOD);
+  CHECK(TIMER_A0->CCR[3] == 0);
+  CHECK(TIMER_A0->CCR[4] == 0);
+}
+
+static void test_motor_direction(void){
+  Host_Reset();
+  Motor_Init();
+  P1->OUT |= 0x01;
+  Motor_SetDirection(MOTOR_LEFT);
+  Host_BitBandFlush();
+  CHECK(P1->OUT == 0x41);                 // left backward, right forward
+  Motor_SetDirection(MOTOR_RIGHT);
+  Host_BitBandFlush();
+  CHECK(P1->OUT == 0x81);
+  Motor_SetDirection(MOTOR_BACKWARD);
+  Host_BitBandFlush();
+  CHECK(P1->OUT == 0x01);
+  Motor_SetDirection(MOTOR_FORWARD);
+  Host_BitBandFlush();
+  CHECK(P1->OUT == 0xC1);
+}
+
+static void test_motor_duty(void){
+  Host_Reset();
+  Motor_Init();
+  Motor_SetDuty(300, 400);
+  CHECK(TIMER_A0->CCR[4] == 300);         // left on P2.7
+  CHECK(TIMER_A0->CCR[3] == 400);         // right on P2.6
+  Motor_SetDuty(5000, 1000);              // clamped below the period
+  CHECK(TIMER_A0->CCR[4] == MOTOR_PERIOD-1);
+  CHECK(TIMER_A0->CCR[3] == MOTOR_PERIOD-1);
+  Motor_Stop();
+  CHECK(TIMER_A0->CCR[3] == 0);
+  CHECK(TIMER_A0->CCR[4] == 0);
+}
+
+static void test_motor_set(void){
+  Host_Reset();
+  Motor_Init();
+  Motor_Set(-250, 600);
+  Host_BitBandFlush();
+  CHECK((P1->OUT&0xC0) == 0x40);          // left backward, right forward
+  CHECK(TIMER_A0->CCR[4] == 250);
+  CHECK(TIMER_A0->CCR[3] == 600);
+  Motor_Set(-2000, 2000);                 // clamped below the period
+  Host_BitBandFlush();
+  CHECK((P1->OUT&0xC0) == 0x40);
+  CHECK(TIMER_A0->CCR[4] == MOTOR_PERIOD-1);
+  CHECK(TIMER_A0->CCR[3] == MOTOR_PERIOD-1);
+  Motor_Set(-32768, 32767);               // the ends of the range
+  Host_BitBandFlush();
+  CHECK((P1->OUT&0xC0) == 0x40);
+  CHECK(TIMER_A0->CCR[4] == MOTOR_PERIOD-1);
+  CHECK(TIMER_A0->CCR[3] == MOTOR_PERIOD-1);
+  Motor_Set(0, -1);
+  Host_BitBandFlush();
+  CHECK((P1->OUT&0xC0) == 0x80);
+  CHECK(TIMER_A0->CCR[4] == 0);
+  CHECK(TIMER_A0->CCR[3] == 1);
+}
+
+static void test_motor_sleep(void){
+  uint32_t leftMs, rightMs;
+  uint64_t now;
+  Host_Reset();
+  Motor_Init();
+  Motor_Set(0, 500);
+  Host_Now += (uint64_t)MOTOR_SLEEP_MS*48000;
+  Motor_PowerTick();
+  Host_BitBandFlush();
+  CHECK((P3->OUT&0xC0) == 0x40);          // stopped left driver sleeps
+  Host_Now += 48000*250;
+  Motor_GetSleepTime(&leftMs, &rightMs);
+  CHECK(leftMs == 250);
+  CHECK(rightMs == 0);
+  // wakes the left driver from an ISR: a busy-wait, no WFI and no
+  // Timer32 alarm
+  now = Host_Now;
+  Host_IBit = 1;
+  Motor_Set(100, 500);
+  Host_BitBandFlush();
+  CHECK((P3->OUT&0xC0) == 0xC0);
+  CHECK(TIMER_A0->CCR[4] == 100);
+  CHECK(Host_Spins == 1 && Host_TimedWaits == 0 && Host_Wfi == 0);
+  CHECK(Host_Now - now == (uint64_t)MOTOR_WAKE_US*48);
+  CHECK(Host_IBit == 1);
+  Host_IBit = 0;
+  Motor_Set(200, 500);                    // already awake, no wait
+  CHECK(Host_Spins == 1);
+  Motor_SetSleepTimeout(0);               // never sleep
+  Motor_Stop();
+  Host_Now += (uint64_t)10*MOTOR_SLEEP_MS*48000;
+  Motor_PowerTick();
+  Host_BitBandFlush();
+  CHECK((P3->OUT&0xC0) == 0xC0);
+  CHECK(Host_IBit == 0);
+}
+
+int main(void){
+  test_pwm_init();
+  test_pwm_duty();
+  test_motor_init();
+  test_motor_direction();
+  test_motor_duty();
+  test_motor_set();
+  test_motor_sleep();
+  return Host_Result("test_motor");
+}
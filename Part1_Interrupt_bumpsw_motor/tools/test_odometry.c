@@ -0,0 +1,97 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        test_odometry.c
+// Function:    Compare the fixed-point odometry with the float reference
+//
+// Odometry.c and OdometryFloat.c run unchanged.  Each path feeds the same
+// encoder counts to Odometry_Update and Odometry_UpdateFloat and checks
+// that the two poses stay together: heading within two binary angle
+// units, position within 0.05% of the distance driven plus half a mm.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include "msp.h"
+#include "hostModel.h"
+#include "Tachometer.h"
+#include "Odometry.h"
+
+#define PI 3.14159265358979
+
+static double MaxPos, MaxTheta;
+
+// Drive n updates of dl and dr steps from l0 and r0, comparing every update
+static void Drive(int32_t l0, int32_t r0, int32_t dl, int32_t dr, int32_t n){
+  int32_t i, l = l0, r = r0;
+  double dist = 0.0, pos, dtheta;
+  Pose_t q;
+  PoseF_t f;
+  Host_Reset();
+  Odometry_Init(l, r);
+  for(i = 0; i < n; i++){
+    l += dl;
+    r += dr;
+    Odometry_Update(l, r);
+    Odometry_UpdateFloat(l, r);
+    dist += fabs((dl + dr)*ODO_MM_PER_STEP/2.0);
+    Odometry_Get(&q);
+    Odometry_GetFloat(&f);
+    pos = hypot(q.x/65536.0 - f.x, q.y/65536.0 - f.y);
+    dtheta = remainder((int16_t)q.theta*PI/32768.0 - f.theta, 2.0*PI);
+    CHECK(pos <= 0.0005*dist + 0.5);
+    CHECK(fabs(dtheta) <= 2.0*2.0*PI/ODO_TURN);
+    if(pos > MaxPos) MaxPos = pos;
+    if(fabs(dtheta) > MaxTheta) MaxTheta = fabs(dtheta);
+  }
+  CHECK(Host_IBit == 0);
+}
+
+static void test_sin(void){
+  int32_t a;
+  double e, maxErr = 0.0;
+  for(a = 0; a < ODO_TURN; a++){
+    e = fabs(Odometry_Sin((uint16_t)a)/32768.0 - sin(a*2.0*PI/ODO_TURN));
+    if(e > maxErr) maxErr = e;
+  }
+  CHECK(maxErr < 0.0002);
+  CHECK(Odometry_Cos(0) == 32767);
+  CHECK(Odometry_Sin(ODO_DEG(90)) == 32767);
+  CHECK(Odometry_Sin(ODO_DEG(270)) == -32767);
+}
+
+static void test_straight(void){
+  Pose_t q;
+  Drive(0, 0, 20, 20, 500);               // 3m forward
+  Odometry_Get(&q);
+  CHECK(q.theta == 0 && q.y == 0);
+  Drive(0, 0, -7, -7, 500);               // 1m backward
+}
+
+static void test_arcs(void){
+  Drive(0, 0, 3, 4, 4000);                // gentle left, several turns
+  Drive(0, 0, 12, 5, 2000);               // tighter right
+  Drive(1000, -3000, 1, 9, 3000);         // not starting at zero
+}
+
+static void test_spin(void){
+  PoseF_t f;
+  Drive(0, 0, -5, 5, 2000);               // in place, about 22 turns
+  Odometry_GetFloat(&f);
+  CHECK(fabs(f.x) < 0.01 && fabs(f.y) < 0.01);
+}
+
+// The counts wrap through 2^31 while driving
+static void test_wrap(void){
+  Drive(INT32_MAX - 5000, INT32_MAX - 4000, 10, 11, 1000);
+  Drive(INT32_MIN + 5000, INT32_MIN + 5000, -9, -9, 1000);
+}
+
+int main(void){
+  test_sin();
+  test_straight();
+  test_arcs();
+  test_spin();
+  test_wrap();
+  printf("test_odometry: worst position error %.3fmm, heading %.6frad\n", MaxPos, MaxTheta);
+  return Host_Result("test_odometry");
+}
@@ -0,0 +1,166 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        test_quadrature.c
+// Function:    Quadrature encoder model for Tachometer.c on the host
+//
+// Each wheel is moved one quadrature state at a time.  On every edge of
+// A the model does what Timer A3 does: it sets CCI to the new level of A,
+// latches the time in CCR, and runs the capture ISR (through TA3IV for
+// the left wheel).  B is on P5, read by the ISR.  Forward is B leading A.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "msp.h"
+#include "hostModel.h"
+#include "Tachometer.h"
+
+void TA3_0_IRQHandler(void);
+void TA3_N_IRQHandler(void);
+
+typedef struct {
+  int32_t  q;               // position in quadrature states
+  int      ccr;             // capture register, 0 right, 1 left
+  uint8_t  bPin;            // B on P5
+} Encoder_t;
+
+static Encoder_t Right = {0, 0, 0x01};
+static Encoder_t Left = {0, 1, 0x04};
+static uint32_t Time3MHz;
+
+// (A,B) for states 0 to 3, forward: 00 01 11 10
+static const uint8_t StateA[4] = {0, 0, 1, 1};
+static const uint8_t StateB[4] = {0, 1, 1, 0};
+
+static void Encoder_Step(Encoder_t *e, int dir){
+  uint8_t a0 = StateA[e->q&3];
+  e->q += dir;
+  if(StateB[e->q&3]){
+    P5->IN |= e->bPin;
+  }else{
+    P5->IN &= (uint8_t)~e->bPin;
+  }
+  if(StateA[e->q&3] != a0){
+    TIMER_A3->CCTL[e->ccr] = (TIMER_A3->CCTL[e->ccr]&~0x0008)
+                           | (StateA[e->q&3] ? 0x0008 : 0) | 0x0001;
+    TIMER_A3->CCR[e->ccr] = (uint16_t)Time3MHz;
+    if(e->ccr == 0){
+      TA3_0_IRQHandler();
+    }else{
+      TIMER_A3->IV = 0x02;
+      TA3_N_IRQHandler();
+    }
+  }
+}
+
+// Move a wheel n states, one every dt counts of the 3MHz timer
+static void Encoder_Move(Encoder_t *e, int32_t n, uint32_t dt){
+  int dir = (n < 0) ? -1 : 1;
+  while(n){
+    Time3MHz += dt;
+    Encoder_Step(e, dir);
+    n -= dir;
+  }
+}
+
+static void Rollover(void){
+  TIMER_A3->IV = 0x0E;
+  TA3_N_IRQHandler();
+}
+
+static void Start(void){
+  Host_Reset();
+  Right.q = Left.q = 0;
+  Time3MHz = 0;
+  Tachometer_Init();
+}
+
+static void test_init(void){
+  Start();
+  CHECK(TIMER_A3->CCTL[0] == 0xC910);     // both edges, capture, armed
+  CHECK(TIMER_A3->CCTL[1] == 0xC910);
+  CHECK((P10->SEL0&0x30) == 0x30);
+  CHECK((P5->DIR&0x05) == 0);
+  CHECK(NVIC->ISER[0] == 0x0000C000);
+}
+
+static void test_count(void){
+  int32_t l, r;
+  uint16_t lp, rp;
+  uint32_t le, re;
+  Start();
+  Encoder_Move(&Right, 4*360, 100);       // one revolution forward
+  Encoder_Move(&Left, -2*360, 100);       // half a revolution backward
+  Tachometer_GetSteps(&l, &r);
+  CHECK(r == TACH_STEPS_PER_REV);
+  CHECK(l == -TACH_STEPS_PER_REV/2);
+  Tachometer_Get(&lp, &le, &rp, &re);
+  CHECK(re == 720);
+  CHECK(le == 360);
+  Encoder_Move(&Right, -4*90, 100);       // back a quarter turn
+  Tachometer_GetSteps(&l, &r);
+  CHECK(r == 3*TACH_STEPS_PER_REV/4);
+}
+
+// A wheel resting on an edge of A makes it chatter, B does not move:
+// the steps must cancel
+static void test_dither(void){
+  int32_t l, r, i;
+  Start();
+  Encoder_Move(&Right, 5, 100);           // state 1, next step is an A edge
+  Encoder_Move(&Left, 5, 100);
+  for(i = 0; i < 1000; i++){
+    Encoder_Move(&Right, 1, 7);
+    Encoder_Move(&Right, -1, 7);
+    Encoder_Move(&Left, (i&1) ? -1 : 1, 7);
+  }
+  Tachometer_GetSteps(&l, &r);
+  CHECK(r == 2);                          // the two A edges of the first 5 states
+  CHECK(l == 2);
+}
+
+// A rising edge of A every 8333 counts is 3MHz*60/(360*8333) = 60 rpm
+static void test_speed(void){
+  int16_t lr, rr;
+  uint16_t lp, rp;
+  uint32_t le, re;
+  Start();
+  Encoder_Move(&Right, 4*100, 8333/4);
+  Encoder_Move(&Left, -4*100, 8333/4);
+  Tachometer_GetSpeed(&lr, &rr);
+  CHECK(rr == 60);
+  CHECK(lr == -60);
+  Tachometer_Get(&lp, &le, &rp, &re);
+  CHECK(rp == 4*(8333/4));
+  // a rollover with edges keeps the speed, two without edges stop it
+  Rollover();
+  Tachometer_GetSpeed(&lr, &rr);
+  CHECK(rr == 60 && lr == -60);
+  Encoder_Move(&Right, 8, 8333/4);       // two rising edges, the first after a pause
+  Rollover();
+  Tachometer_GetSpeed(&lr, &rr);
+  CHECK(rr == 60);
+  CHECK(lr == 0);
+  Rollover();
+  Tachometer_GetSpeed(&lr, &rr);
+  CHECK(rr == 0);
+}
+
+// The 16-bit capture time wraps every 21.8ms, the period must not care
+static void test_wrap(void){
+  uint16_t lp, rp;
+  uint32_t le, re;
+  Start();
+  Time3MHz = 0xFFFF - 1000;
+  Encoder_Move(&Right, 8, 750);           // straddles the wrap
+  Tachometer_Get(&lp, &le, &rp, &re);
+  CHECK(rp == 3000);
+}
+
+int main(void){
+  test_init();
+  test_count();
+  test_dither();
+  test_speed();
+  test_wrap();
+  return Host_Result("test_quadrature");
+}
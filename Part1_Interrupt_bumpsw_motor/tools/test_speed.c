@@ -0,0 +1,223 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        test_speed.c
+// Function:    Plant model of the wheels for SpeedControl.c on the host
+//
+// Usage: build/test_speed              run the regression tests
+//        build/test_speed kp ki ms     print a step response, gains in
+//                                      real units as in SPEED_Q15
+//
+// SpeedControl.c and Odometry.c run unchanged, one SysTick_Handler call
+// per simulated ms.  Tachometer and motor are replaced by the model:
+// each wheel is a first-order DC motor whose no-load speed follows duty
+// times battery voltage, above a friction dead band.  The model turns
+// the wheel angle back into tachometer edges, periods and steps exactly
+// as Tachometer.c reports them.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "msp.h"
+#include "hostModel.h"
+#include "Tachometer.h"
+#include "motor.h"
+#include "SpeedControl.h"
+
+void SysTick_Handler(void);
+
+#define PLANT_TAU_MS    80.0        // mechanical time constant
+#define PLANT_RPM_FULL  150.0       // no-load speed at full duty and 7.2V
+#define PLANT_DEADBAND  80          // duty below this does not turn the wheel
+
+typedef struct {
+  double   rpm;
+  double   rev;             // wheel angle in revolutions
+  uint32_t edges;           // rising edges of A, 360 per revolution
+  uint64_t lastEdge;        // time of the last edge, 1/3MHz units
+  uint16_t period;
+  uint16_t duty;
+} Wheel_t;
+
+static Wheel_t WL, WR;
+static double Vbat;
+static uint64_t Now3MHz;    // simulated time in Timer A3 counts
+
+static void Plant_Reset(double vbat){
+  Wheel_t zero = {0};
+  WL = WR = zero;
+  Vbat = vbat;
+  Now3MHz = 0;
+}
+
+static void Plant_Wheel(Wheel_t *w){
+  double target = 0.0;
+  uint32_t edges;
+  if(w->duty > PLANT_DEADBAND){
+    target = PLANT_RPM_FULL*(w->duty - PLANT_DEADBAND)/(MOTOR_PERIOD - PLANT_DEADBAND)*Vbat/7.2;
+  }
+  w->rpm += (target - w->rpm)/PLANT_TAU_MS;
+  w->rev += w->rpm/60000.0;
+  edges = (uint32_t)(w->rev*360.0);
+  if(edges != w->edges){
+    // time of the last edge inside this ms
+    uint64_t t = Now3MHz + 3000 - (uint64_t)((w->rev*360.0 - edges)/(w->rpm*6.0/1000.0)*3000.0);
+    w->period = (uint16_t)(t - w->lastEdge);
+    w->lastEdge = t;
+    w->edges = edges;
+  }
+  if(Now3MHz + 3000 - w->lastEdge > 65536) w->period = 0;   // Timer A3 rollover
+}
+
+static void Plant_Step(void){
+  Plant_Wheel(&WL);
+  Plant_Wheel(&WR);
+  Now3MHz += 3000;
+  Host_Now += 48000;
+  SysTick_Handler();
+}
+
+// Tachometer.c
+void Tachometer_Init(void){}
+void Tachometer_Get(uint16_t *leftPeriod, uint32_t *leftEdges,
+                    uint16_t *rightPeriod, uint32_t *rightEdges){
+  *leftPeriod = WL.period;
+  *leftEdges = WL.edges;
+  *rightPeriod = WR.period;
+  *rightEdges = WR.edges;
+}
+void Tachometer_GetSteps(int32_t *leftSteps, int32_t *rightSteps){
+  *leftSteps = (int32_t)(WL.rev*TACH_STEPS_PER_REV);
+  *rightSteps = (int32_t)(WR.rev*TACH_STEPS_PER_REV);
+}
+
+// motor.c
+void Motor_Init(void){}
+void Motor_PowerTick(void){}
+void Motor_SetDuty(uint16_t leftDuty, uint16_t rightDuty){
+  if(leftDuty >= MOTOR_PERIOD) leftDuty = MOTOR_PERIOD-1;
+  if(rightDuty >= MOTOR_PERIOD) rightDuty = MOTOR_PERIOD-1;
+  WL.duty = leftDuty;
+  WR.duty = rightDuty;
+}
+
+// Run for ms and return the largest |error| and the mean speed of the
+// left wheel over the last half
+static void Run(uint32_t ms, int32_t target, int32_t *maxErr, int32_t *meanRpm, int32_t *peak){
+  uint32_t i;
+  int64_t sum = 0;
+  *maxErr = 0;
+  *peak = 0;
+  for(i = 0; i < ms; i++){
+    Plant_Step();
+    if(SpeedControl_LeftRpm > *peak) *peak = SpeedControl_LeftRpm;
+    if(i >= ms/2){
+      int32_t e = abs((int32_t)SpeedControl_LeftRpm - target);
+      if(e > *maxErr) *maxErr = e;
+      sum += SpeedControl_LeftRpm;
+    }
+  }
+  *meanRpm = (int32_t)(sum/(ms - ms/2));
+}
+
+static void Start(double vbat){
+  Host_Reset();
+  Plant_Reset(vbat);
+  SpeedControl_Init();
+  SpeedControl_SetGains(SPEED_KP, SPEED_KI);
+}
+
+static void test_init(void){
+  Start(7.2);
+  CHECK(SysTick->LOAD == 47999);          // 1kHz at 48MHz
+  CHECK(SysTick->CTRL == 7);
+  CHECK(SCB->SHP[11] == 0x60);
+}
+
+static void test_step(void){
+  int32_t maxErr, mean, peak;
+  Start(7.2);
+  SpeedControl_SetTarget(60, 60);
+  Run(2000, 60, &maxErr, &mean, &peak);
+  CHECK(abs(mean - 60) <= 1);
+  CHECK(maxErr <= 3);                     // one edge period of jitter
+  CHECK(peak <= 72);                      // less than 20% overshoot
+  CHECK(SpeedControl_RightRpm == SpeedControl_LeftRpm);
+}
+
+static void test_battery_sag(void){
+  int32_t maxErr, mean, peak;
+  Start(7.2);
+  SpeedControl_SetTarget(90, 90);
+  Run(1500, 90, &maxErr, &mean, &peak);
+  Vbat = 6.0;                             // sags by 17%
+  Run(2000, 90, &maxErr, &mean, &peak);
+  CHECK(abs(mean - 90) <= 1);
+  CHECK(maxErr <= 4);
+  CHECK(WL.duty > 600);                   // the duty went up to make up for it
+}
+
+// Saturated for a long time, the integral must not have wound up:
+// after the target drops the wheel slows at once and comes back to the
+// new target from below without overshooting it
+static void test_windup(void){
+  int32_t maxErr, mean, peak;
+  uint32_t i, crossed = 0;
+  Start(7.2);
+  SpeedControl_SetTarget(400, 400);       // out of reach, output saturated
+  Run(3000, 400, &maxErr, &mean, &peak);
+  CHECK(WL.duty == MOTOR_PERIOD-1);
+  SpeedControl_SetTarget(60, 60);
+  for(i = 0; i < 1000; i++){
+    Plant_Step();
+    if(!crossed && (SpeedControl_LeftRpm < 60)) crossed = i;
+    if(crossed) CHECK(SpeedControl_LeftRpm <= 62);
+  }
+  CHECK(crossed > 0 && crossed < 100);
+  Run(1000, 60, &maxErr, &mean, &peak);
+  CHECK(abs(mean - 60) <= 1);
+}
+
+static void test_stop(void){
+  int32_t maxErr, mean, peak;
+  Start(7.2);
+  SpeedControl_SetTarget(60, 60);
+  Run(1000, 60, &maxErr, &mean, &peak);
+  SpeedControl_SetTarget(0, 0);
+  Plant_Step();
+  CHECK(WL.duty == 0 && WR.duty == 0);
+  Run(500, 0, &maxErr, &mean, &peak);
+  CHECK(SpeedControl_LeftRpm == 0);
+}
+
+// A large gain times a large error must saturate, not wrap negative
+static void test_gain_overflow(void){
+  Start(7.2);
+  SpeedControl_SetGains(SPEED_Q15(4.0), SPEED_Q15(4.0));
+  SpeedControl_SetTarget(65535, 65535);
+  Plant_Step();
+  CHECK(WL.duty == MOTOR_PERIOD-1);
+  Plant_Step();
+  CHECK(WL.duty == MOTOR_PERIOD-1);
+}
+
+int main(int argc, char **argv){
+  if(argc == 4){
+    uint32_t i, ms = (uint32_t)atoi(argv[3]);
+    Start(7.2);
+    SpeedControl_SetGains(SPEED_Q15(atof(argv[1])), SPEED_Q15(atof(argv[2])));
+    SpeedControl_SetTarget(60, 60);
+    printf("ms rpm duty\n");
+    for(i = 0; i < ms; i++){
+      Plant_Step();
+      printf("%u %u %u\n", i, SpeedControl_LeftRpm, WL.duty);
+    }
+    return 0;
+  }
+  test_init();
+  test_step();
+  test_battery_sag();
+  test_windup();
+  test_stop();
+  test_gain_overflow();
+  return Host_Result("test_speed");
+}
@@ -86,5 +86,22 @@ void WaitForInterrupt(void){
   __asm  ("    WFI\n"
           "    BX     LR\n");
 }
+
+//*********** CompareAndSwap ************************
+// store newval in *addr if *addr still holds oldval, using LDREX/STREX
+// inputs:  addr (R0), oldval (R1), newval (R2)
+// outputs: 1 if stored, 0 if *addr differed or the store lost its reservation
+uint32_t CompareAndSwap(volatile uint32_t *addr, uint32_t oldval, uint32_t newval){
+  __asm  ("    LDREX   R3, [R0]     ; read and reserve *addr\n"
+          "    CMP     R3, R1\n"
+          "    ITT     EQ\n"
+          "    STREXEQ R3, R2, [R0] ; R3 = 0 if the reservation held\n"
+          "    CMPEQ   R3, #0\n"
+          "    CLREX                ; drop the reservation if not stored\n"
+          "    ITE     EQ\n"
+          "    MOVEQ   R0, #1\n"
+          "    MOVNE   R0, #0\n"
+          "    BX      LR\n");
+}
 	
 
@@ -48,6 +48,7 @@ those of the authors and should not be interpreted as representing official
 policies, either expressed or implied, of the FreeBSD Project.
 */
 
+#include <stdint.h>
 
 /**
  * Disables Interrupts
@@ -105,3 +106,19 @@ void EndCritical(long sr);    // restore I bit to previous value
  */
 void WaitForInterrupt(void);  
 
+
+/**
+ * Atomically replace a word in memory if it still holds an expected value.
+ * Uses LDREX/STREX, so it is safe between tasks and interrupts without
+ * masking interrupts.
+ *
+ * @param  addr is the address of the word
+ * @param  oldval is the value the word must hold
+ * @param  newval is the value to store
+ * @return 1 if newval was stored, 0 if the word did not hold oldval or
+ *         the exclusive store was interrupted (the caller should retry)
+ *
+ * @brief  Compare and swap of a 32-bit word
+ */
+uint32_t CompareAndSwap(volatile uint32_t *addr, uint32_t oldval, uint32_t newval);
+
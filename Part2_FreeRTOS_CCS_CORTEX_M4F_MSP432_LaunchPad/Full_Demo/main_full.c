@@ -93,6 +93,9 @@
 #include "recmutex.h"
 #include "partest.h"
 #include "serial.h"
+#include "serialLog.h"
+#include "bootCheck.h"
+#include "kvStore.h"
 #include "TimerDemo.h"
 #include "IntQueue.h"
 #include "EventGroupsDemo.h"
@@ -109,6 +112,9 @@
 #define mainCHECK_TASK_PRIORITY				( configMAX_PRIORITIES - 1 )
 #define mainQUEUE_OVERWRITE_PRIORITY		( tskIDLE_PRIORITY )
 
+/* The log drain task only runs when nothing else needs the CPU. */
+#define mainLOG_DRAIN_TASK_PRIORITY			( tskIDLE_PRIORITY )
+
 /* The priority used by the UART command console task. */
 #define mainUART_COMMAND_CONSOLE_TASK_PRIORITY	( configMAX_PRIORITIES - 2 )
 
@@ -181,6 +187,11 @@ void vFullDemoIdleHook( void );
  */
 static void prvConfigureClocks( void );
 
+/*
+ * Log the result of the image check made by resetISR, and the time it took.
+ */
+static void prvLogBootCheck( void );
+
 /*-----------------------------------------------------------*/
 
 /* The following two variables are used to communicate the status of the
@@ -197,10 +208,22 @@ void main_full( void )
  	clock as it uses low power features.  */
 	prvConfigureClocks();
 
-	/* Init the serial port for use by the CLI.  The baud rate parameter is not
-	used so set to 0 to make this obvious. */
+	/* Init the serial port for use by the CLI.  A baud rate parameter of 0 selects
+	the default 19200 baud. */
 	xSerialPortInitMinimal( 0, mainRX_QUEUE_LENGTH );
 
+	/* Start the task that sends xSerialLogWrite() records to the UART. */
+	vSerialLogStart( mainLOG_DRAIN_TASK_PRIORITY );
+	prvLogBootCheck();
+
+	/* Open the key/value store of calibration data, which formats it the
+	first time and finishes anything a reset cut short.  It creates its
+	mutex, so it runs here before the scheduler starts. */
+	if( kv_init() == 0 )
+	{
+		xSerialLogPrint( "kv store: flash error\r\n" );
+	}
+
 	/* Start all the other standard demo/test tasks.  They have no particular
 	functionality, but do demonstrate how to use the FreeRTOS API and test the
 	kernel port. */
@@ -417,6 +440,18 @@ static void prvConfigureClocks( void )
 }
 /*-----------------------------------------------------------*/
 
+static void prvLogBootCheck( void )
+{
+char cBuffer[ 64 ];
+uint32_t ulResult, ulCycles;
+
+	/* The check runs with MCLK at 12MHz, so 12 cycles per us. */
+	ulResult = bootCheck_status( &ulCycles );
+	sprintf( cBuffer, "boot check %u: %u cycles, %u us\r\n", ( unsigned ) ulResult, ( unsigned ) ulCycles, ( unsigned ) ( ulCycles / 12UL ) );
+	xSerialLogPrint( cBuffer );
+}
+/*-----------------------------------------------------------*/
+
 #if( configCREATE_SIMPLE_TICKLESS_DEMO == 0 )
 
 	void vApplicationTickHook( void )
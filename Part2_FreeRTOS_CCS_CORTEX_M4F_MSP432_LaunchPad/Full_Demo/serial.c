@@ -30,13 +30,19 @@
 
 	Note1:  This driver is used specifically to provide an interface to the
 	FreeRTOS+CLI command interpreter.  It is *not* intended to be a generic
-	serial port driver.  Nor is it intended to be used as an example of an
-	efficient implementation.  In particular, a queue is used to buffer
-	received characters, which is fine in this case as key presses arrive
-	slowly, but a DMA and/or RAM buffer should be used in place of the queue in
-	applications that expect higher throughput.
-
-	Note2:  This driver does not attempt to handle UART errors.
+	serial port driver.  Received characters are written by the interrupt into
+	a stream buffer, which only wakes the reading task once its trigger level
+	is reached, so bulk transfers do not cost a context switch per character.
+	The receive DMA trigger (channel 1) is taken by the wavetable audio, so
+	reception stays interrupt driven.
+
+	Note2:  This driver does not attempt to handle UART errors, other than
+	counting characters lost to overruns or a full stream buffer.
+
+	Note3:  Transmitted characters are copied into a ring buffer and the
+	function returns.  DMA channel 0 (UCA0TXIFG trigger) moves the ring
+	to TXBUF, so there are one or two interrupts per contiguous block of the
+	ring rather than one UART interrupt per character.
 */
 
 /* Scheduler includes. */
@@ -44,9 +50,41 @@
 #include "task.h"
 #include "queue.h"
 #include "semphr.h"
+#include "stream_buffer.h"
 
 /* Demo application includes. */
 #include "serial.h"
+#include "serialExt.h"
+#include "serialBaud.h"
+#include "dmaTable.h"
+
+/* The SMCLK frequency set by prvConfigureClocks() in main_full.c, and the
+baud rate used when xSerialPortInitMinimal() is not given one. */
+#define serSMCLK_HZ				( 48000000UL )
+#define serDEFAULT_BAUD			( 19200UL )
+
+/* The size of the transmit ring buffer.  Must be a power of 2 and no larger
+than 1024, the longest DMA transfer. */
+#define serTX_RING_SIZE			( 512UL )
+
+/* The DMA channel that feeds TXBUF. */
+#define serTX_DMA_CHANNEL		( 0UL )
+
+/* The number of tasks that can wait in xSerialTxFlush() at the same time.
+Any more poll the ring instead. */
+#define serTX_MAX_WAITERS		( 4UL )
+
+/* The smallest receive stream buffer, in bytes.  The length passed to
+xSerialPortInitMinimal() is used instead if it is larger. */
+#define serRX_BUFFER_SIZE		( 256UL )
+
+/* xSerialRead() wakes after this many characters, or on an idle line, rather
+than once per character. */
+#define serRX_TRIGGER_LEVEL		( 32UL )
+
+/* The line is treated as idle, and xSerialRead() returns what it has, once no
+character has arrived for this long. */
+#define serRX_IDLE_TIME			( pdMS_TO_TICKS( 5UL ) )
 
 /*-----------------------------------------------------------*/
 
@@ -55,50 +93,78 @@
  */
 void vUART_Handler( void );
 
+/*
+ * The handler of the DMA_INT1 interrupt, raised when the transmit DMA has
+ * moved a block of the ring into TXBUF.
+ */
+void vSerialTxDMA_Handler( void );
+
+/*
+ * Start a DMA transfer of the next contiguous block of the ring, if there is
+ * one and no transfer is running.  Called with interrupts masked.
+ */
+static void prvStartTx( void );
+
+/*
+ * Reinitialise the UART for ulBaud from a clock of ulClock Hz.  Returns pdFAIL,
+ * leaving the UART untouched, if the pair cannot be generated.
+ */
+static BaseType_t prvConfigureBaud( uint32_t ulClock, uint32_t ulBaud );
+
 /*-----------------------------------------------------------*/
 
-/* The queue into which received key presses are placed.  NOTE THE COMMENTS AT
-THE TOP OF THIS FILE REGARDING THE USE OF QUEUES FOR THIS PURPOSE. */
-static QueueHandle_t xRxQueue = NULL;
+/* The stream buffer into which received characters are placed. */
+static StreamBufferHandle_t xRxStream = NULL;
+
+/* Characters lost because the UART overran or the stream buffer was full. */
+static volatile uint32_t ulRxLost = 0;
+
+/* The transmit ring.  Characters between ulTxTail and ulTxHead are waiting to
+be sent, ulTxDMALength of them starting at ulTxTail are being sent by the DMA.
+The indexes are free running and masked when used. */
+static uint8_t ucTxRing[ serTX_RING_SIZE ];
+static volatile uint32_t ulTxHead = 0, ulTxTail = 0, ulTxDMALength = 0;
+
+/* The tasks waiting in xSerialTxFlush() for the ring to empty.  A slot is
+cleared by the DMA interrupt when it notifies the task, or by the task itself
+when its wait times out, never by another task. */
+static TaskHandle_t volatile xTxWaiters[ serTX_MAX_WAITERS ] = { NULL };
 
-/* Variables used in the Tx interrupt to send a string. */
-static volatile const signed char *pcStringStart = NULL, *pcStringEnd = NULL;
-static volatile TaskHandle_t xTransmittingTask = NULL;
+/* Called from the DMA interrupt when the ring becomes empty, can be NULL. */
+static void ( *pxTxCompleteCallback )( void ) = NULL;
 
 static EUSCI_A_Type * const pxUARTA0 = ( EUSCI_A_Type * ) EUSCI_A0_BASE;
 
-/* UART Configuration for 19200 baud.  Value generated using the tool provided
-on the following page:
-http://software-dl.ti.com/msp430/msp430_public_sw/mcu/msp430/MSP430BaudRateConverter/index.html
- */
-const eUSCI_UART_Config xUARTConfig =
-{
-	EUSCI_A_UART_CLOCKSOURCE_SMCLK,	/* SMCLK Clock Source. */
-	156,							/* BRDIV */
-	4,								/* UCxBRF */
-	0,								/* UCxBRS */
-	EUSCI_A_UART_NO_PARITY,			/* No Parity. */
-	EUSCI_A_UART_LSB_FIRST,			/* MSB First. */
-	EUSCI_A_UART_ONE_STOP_BIT,		/* One stop bit. */
-	EUSCI_A_UART_MODE,				/* UART mode. */
-	EUSCI_A_UART_OVERSAMPLING_BAUDRATE_GENERATION /* Low Frequency Mode. */
-};
+/* The baud rate in use, kept so it can be restored after a clock change. */
+static uint32_t ulBaudRate = serDEFAULT_BAUD;
+
+/* UART Configuration for 19200 baud from a 48MHz SMCLK, worked out at compile
+time by the macros in serialBaud.h (BRDIV 156, UCxBRF 4, UCxBRS 0). */
+typedef char serDEFAULT_BAUD_MUST_BE_VALID[ serBAUD_VALID( serSMCLK_HZ, serDEFAULT_BAUD ) ? 1 : -1 ];
+const eUSCI_UART_Config xUARTConfig = serBAUD_UART_CONFIG( serSMCLK_HZ, serDEFAULT_BAUD );
 
 /*
  * See the serial2.h header file.
  */
 xComPortHandle xSerialPortInitMinimal( unsigned long ulWantedBaud, unsigned long uxQueueLength )
 {
-	/* Create the queue used to hold received characters.  NOTE THE COMMENTS AT
-	THE TOP OF THIS FILE REGARDING THE USE OF QUEUES FOR THIS PURPSOE. */
-	xRxQueue = xQueueCreate( uxQueueLength, sizeof( char ) );
-	configASSERT( xRxQueue );
+	/* Create the stream buffer used to hold received characters. */
+	if( uxQueueLength < serRX_BUFFER_SIZE )
+	{
+		uxQueueLength = serRX_BUFFER_SIZE;
+	}
+	xRxStream = xStreamBufferCreate( uxQueueLength, 1 );
+	configASSERT( xRxStream );
 
-	/* Use the library functions to initialise and enable the UART. */
-	MAP_UART_initModule( EUSCI_A0_BASE, &xUARTConfig );
-	MAP_UART_enableModule( EUSCI_A0_BASE );
-	MAP_UART_clearInterruptFlag( EUSCI_A0_BASE, EUSCI_A_UART_RECEIVE_INTERRUPT | EUSCI_A_UART_TRANSMIT_INTERRUPT );
-	MAP_UART_enableInterrupt( EUSCI_A0_BASE, EUSCI_A_UART_RECEIVE_INTERRUPT );
+	/* Use the library functions to initialise and enable the UART.  A non zero
+	ulWantedBaud is worked out from the SMCLK frequency at run time. */
+	if( ( ulWantedBaud == 0UL ) || ( prvConfigureBaud( MAP_CS_getSMCLK(), ulWantedBaud ) == pdFAIL ) )
+	{
+		MAP_UART_initModule( EUSCI_A0_BASE, &xUARTConfig );
+		MAP_UART_enableModule( EUSCI_A0_BASE );
+		MAP_UART_clearInterruptFlag( EUSCI_A0_BASE, EUSCI_A_UART_RECEIVE_INTERRUPT | EUSCI_A_UART_TRANSMIT_INTERRUPT );
+		MAP_UART_enableInterrupt( EUSCI_A0_BASE, EUSCI_A_UART_RECEIVE_INTERRUPT );
+	}
 
 	/* The interrupt handler uses the FreeRTOS API function so its priority must
 	be at or below the configured maximum system call interrupt priority.
@@ -107,6 +173,15 @@ xComPortHandle xSerialPortInitMinimal( unsigned long ulWantedBaud, unsigned long
 	MAP_Interrupt_setPriority( INT_EUSCIA0, configKERNEL_INTERRUPT_PRIORITY );
 	MAP_Interrupt_enableInterrupt( INT_EUSCIA0 );
 
+	/* Transmit DMA: bytes from the ring to TXBUF, one per UCA0TXIFG. */
+	dmaTable_init();
+	MAP_DMA_assignChannel( DMA_CH0_EUSCIA0TX );
+	MAP_DMA_disableChannelAttribute( serTX_DMA_CHANNEL, UDMA_ATTR_ALTSELECT | UDMA_ATTR_USEBURST | UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK );
+	MAP_DMA_setChannelControl( UDMA_PRI_SELECT | serTX_DMA_CHANNEL, UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_1 );
+	MAP_DMA_assignInterrupt( DMA_INT1, serTX_DMA_CHANNEL );
+	MAP_Interrupt_setPriority( INT_DMA_INT1, configKERNEL_INTERRUPT_PRIORITY );
+	MAP_Interrupt_enableInterrupt( INT_DMA_INT1 );
+
 	/* Only one UART is supported so the handle is not used. */
 	return ( xComPortHandle ) 0;
 }
@@ -119,79 +194,364 @@ BaseType_t xReturn;
 	/* Only a single port is supported. */
 	( void ) pxPort;
 
-	/* Obtain a received character from the queue - entering the Blocked state
-	(so not consuming any processing time) to wait for a character if one is not
-	already available. */
-	xReturn = xQueueReceive( xRxQueue, pcRxedChar, xBlockTime );
+	/* Obtain a received character from the stream buffer - entering the
+	Blocked state (so not consuming any processing time) to wait for a character
+	if one is not already available.  Key presses must not wait for a trigger
+	level left over from xSerialRead(). */
+	xStreamBufferSetTriggerLevel( xRxStream, 1 );
+	if( xStreamBufferReceive( xRxStream, pcRxedChar, sizeof( *pcRxedChar ), xBlockTime ) != 0 )
+	{
+		xReturn = pdPASS;
+	}
+	else
+	{
+		xReturn = pdFAIL;
+	}
+
 	return xReturn;
 }
 /*-----------------------------------------------------------*/
 
+size_t xSerialRead( void *pvBuffer, size_t xLength, TickType_t xBlockTime )
+{
+uint8_t *pucBuffer = ( uint8_t * ) pvBuffer;
+size_t xReceived, xTotal;
+size_t xTrigger = ( xLength < serRX_TRIGGER_LEVEL ) ? xLength : serRX_TRIGGER_LEVEL;
+
+	if( xLength == 0 )
+	{
+		return 0;
+	}
+
+	/* Wait up to xBlockTime for the first character. */
+	xStreamBufferSetTriggerLevel( xRxStream, 1 );
+	xTotal = xStreamBufferReceive( xRxStream, pucBuffer, xLength, xBlockTime );
+
+	/* Then keep reading, woken every serRX_TRIGGER_LEVEL characters, until the
+	buffer is full or nothing arrives for serRX_IDLE_TIME. */
+	while( ( xTotal != 0 ) && ( xTotal < xLength ) )
+	{
+		if( ( xLength - xTotal ) < xTrigger )
+		{
+			xTrigger = xLength - xTotal;
+		}
+		xStreamBufferSetTriggerLevel( xRxStream, xTrigger );
+
+		xReceived = xStreamBufferReceive( xRxStream, pucBuffer + xTotal, xLength - xTotal, serRX_IDLE_TIME );
+		if( xReceived == 0 )
+		{
+			break;
+		}
+		xTotal += xReceived;
+	}
+
+	return xTotal;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulSerialRxLost( void )
+{
+	return ulRxLost;
+}
+/*-----------------------------------------------------------*/
+
 void vSerialPutString( xComPortHandle pxPort, const signed char * const pcString, unsigned short usStringLength )
 {
 const TickType_t xMaxWaitTime = pdMS_TO_TICKS( 20UL * ( uint32_t ) usStringLength );
+size_t xSent = 0;
 
 	/* Only a single port is supported. */
 	( void ) pxPort;
 
-	/* Note there is no mutual exclusion at the driver level.  If more than one
-	task is using the serial port then mutual exclusion should be provided where
-	this function is called. */
+	/* The bytes taken by one xSerialWrite() call go into the ring together, but
+	a string longer than the free space takes several calls, so output from
+	other tasks can be interleaved with it. */
 
-	/* Ensure notifications are not already waiting. */
-	( void ) ulTaskNotifyTake( pdTRUE, 0 );
+	/* Queue the string, only waiting if the ring is full. */
+	while( xSent < usStringLength )
+	{
+		xSent += xSerialWrite( pcString + xSent, usStringLength - xSent );
 
-	/* Remember which task is sending the byte. */
-	xTransmittingTask = xTaskGetCurrentTaskHandle();
+		if( xSent < usStringLength )
+		{
+			if( xSerialTxFlush( xMaxWaitTime ) == pdFAIL )
+			{
+				break;
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
 
-	/* Mark the start and end of the data being sent. */
-	pcStringStart = pcString;
-	pcStringEnd = pcStringStart + usStringLength;
+signed portBASE_TYPE xSerialPutChar( xComPortHandle pxPort, signed char cOutChar, TickType_t xBlockTime )
+{
+	/* Only a single port is supported. */
+	( void ) pxPort;
 
-	/* Start to send the first byte. */
-	pxUARTA0->TXBUF = ( uint_fast8_t ) *pcString;
+	if( xSerialWrite( &cOutChar, sizeof( cOutChar ) ) == 0 )
+	{
+		/* The ring is full, wait for it to drain. */
+		xSerialTxFlush( xBlockTime );
+		if( xSerialWrite( &cOutChar, sizeof( cOutChar ) ) == 0 )
+		{
+			return pdFAIL;
+		}
+	}
 
-	/* Enable the interrupt then wait for the byte to be sent.  The interrupt
-	will be disabled again in the ISR. */
-	MAP_UART_enableInterrupt( EUSCI_A0_BASE, EUSCI_A_UART_TRANSMIT_INTERRUPT );
-	ulTaskNotifyTake( pdTRUE, xMaxWaitTime );
+	return pdPASS;
 }
 /*-----------------------------------------------------------*/
 
-signed portBASE_TYPE xSerialPutChar( xComPortHandle pxPort, signed char cOutChar, TickType_t xBlockTime )
+size_t xSerialWrite( const void *pvData, size_t xLength )
 {
-const TickType_t xMaxWaitTime = pdMS_TO_TICKS( 20UL );
+const uint8_t *pucData = ( const uint8_t * ) pvData;
+size_t xSpace, x;
 
-	/* Only a single port is supported. */
-	( void ) pxPort;
+	taskENTER_CRITICAL();
+	{
+		xSpace = serTX_RING_SIZE - ( ulTxHead - ulTxTail );
+		if( xLength > xSpace )
+		{
+			xLength = xSpace;
+		}
 
-	/* Note there is no mutual exclusion at the driver level.  If more than one
-	task is using the serial port then mutual exclusion should be provided where
-	this function is called. */
+		for( x = 0; x < xLength; x++ )
+		{
+			ucTxRing[ ( ulTxHead + x ) & ( serTX_RING_SIZE - 1UL ) ] = pucData[ x ];
+		}
+		ulTxHead += xLength;
+
+		prvStartTx();
+	}
+	taskEXIT_CRITICAL();
+
+	return xLength;
+}
+/*-----------------------------------------------------------*/
+
+size_t xSerialTxSpace( void )
+{
+	/* No critical section, the DMA interrupt or another task can change the
+	answer straight after anyway. */
+	return serTX_RING_SIZE - ( ulTxHead - ulTxTail );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSerialTxFlush( TickType_t xBlockTime )
+{
+TaskHandle_t xThisTask = xTaskGetCurrentTaskHandle();
+TimeOut_t xTimeOut;
+BaseType_t xReturn = pdFAIL;
+uint32_t x, ulSlot = serTX_MAX_WAITERS;
 
 	/* Ensure notifications are not already waiting. */
 	( void ) ulTaskNotifyTake( pdTRUE, 0 );
 
-	/* Remember which task is sending the byte. */
-	xTransmittingTask = xTaskGetCurrentTaskHandle();
+	taskENTER_CRITICAL();
+	{
+		if( ulTxHead == ulTxTail )
+		{
+			taskEXIT_CRITICAL();
+			return pdPASS;
+		}
 
-	/* Mark the start and end of the data being sent - in this case just a
-	single byte. */
-	pcStringStart = &cOutChar;
-	pcStringEnd = pcStringStart + sizeof( cOutChar );
+		/* Join the tasks the DMA interrupt notifies once the ring is empty. */
+		for( x = 0; x < serTX_MAX_WAITERS; x++ )
+		{
+			if( xTxWaiters[ x ] == NULL )
+			{
+				xTxWaiters[ x ] = xThisTask;
+				ulSlot = x;
+				break;
+			}
+		}
+	}
+	taskEXIT_CRITICAL();
 
-	/* Start to send the byte. */
-	pxUARTA0->TXBUF = ( uint_fast8_t ) cOutChar;
+	if( ulSlot == serTX_MAX_WAITERS )
+	{
+		/* Every slot is taken, poll instead. */
+		vTaskSetTimeOutState( &xTimeOut );
+		while( ( ulTxHead != ulTxTail ) && ( xTaskCheckForTimeOut( &xTimeOut, &xBlockTime ) == pdFALSE ) )
+		{
+			vTaskDelay( 1 );
+		}
+
+		return ( ulTxHead == ulTxTail ) ? pdPASS : pdFAIL;
+	}
+
+	if( ulTaskNotifyTake( pdTRUE, xBlockTime ) != 0 )
+	{
+		/* The ring emptied, it may have been written to again since. */
+		xReturn = pdPASS;
+	}
+	else
+	{
+		taskENTER_CRITICAL();
+		{
+			if( xTxWaiters[ ulSlot ] == xThisTask )
+			{
+				/* Timed out, leave the slot to other tasks. */
+				xTxWaiters[ ulSlot ] = NULL;
+			}
+			else
+			{
+				/* The interrupt took the slot between the timeout and here, so
+				its notification is pending.  Consume it. */
+				( void ) ulTaskNotifyTake( pdTRUE, 0 );
+				xReturn = pdPASS;
+			}
+
+			if( ulTxHead == ulTxTail )
+			{
+				xReturn = pdPASS;
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vSerialSetTxCallback( void ( *pxCallback )( void ) )
+{
+	pxTxCompleteCallback = pxCallback;
+}
+/*-----------------------------------------------------------*/
+
+static void prvStartTx( void )
+{
+uint32_t ulStart, ulLength;
+
+	if( ( ulTxDMALength != 0 ) || ( ulTxHead == ulTxTail ) )
+	{
+		return;
+	}
+
+	if( ( pxUARTA0->IFG & EUSCI_A_IFG_TXIFG ) == 0 )
+	{
+		/* TXBUF still holds the last character of the previous block.  The
+		Tx interrupt starts this block once TXBUF is empty. */
+		MAP_UART_enableInterrupt( EUSCI_A0_BASE, EUSCI_A_UART_TRANSMIT_INTERRUPT );
+		return;
+	}
+
+	/* Send up to the end of the ring, the rest goes in the next block. */
+	ulStart = ulTxTail & ( serTX_RING_SIZE - 1UL );
+	ulLength = ulTxHead - ulTxTail;
+	if( ulLength > serTX_RING_SIZE - ulStart )
+	{
+		ulLength = serTX_RING_SIZE - ulStart;
+	}
+	ulTxDMALength = ulLength;
+
+	/* The CPU writes the first character, which clears UCA0TXIFG.  Each time
+	TXBUF empties again UCA0TXIFG requests the DMA to write the next one. */
+	if( ulLength > 1UL )
+	{
+		MAP_DMA_setChannelTransfer( UDMA_PRI_SELECT | serTX_DMA_CHANNEL, UDMA_MODE_BASIC, &ucTxRing[ ulStart + 1UL ], ( void * ) MAP_UART_getTransmitBufferAddressForDMA( EUSCI_A0_BASE ), ulLength - 1UL );
+		MAP_DMA_enableChannel( serTX_DMA_CHANNEL );
+		pxUARTA0->TXBUF = ucTxRing[ ulStart ];
+	}
+	else
+	{
+		/* A single character needs no DMA, the Tx interrupt reports when it
+		has moved on. */
+		pxUARTA0->TXBUF = ucTxRing[ ulStart ];
+		MAP_UART_enableInterrupt( EUSCI_A0_BASE, EUSCI_A_UART_TRANSMIT_INTERRUPT );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* A block has been handed to the UART, move on to the next one or report that
+the ring is empty.  Called from an interrupt. */
+static void prvTxDone( BaseType_t *pxHigherPriorityTaskWoken )
+{
+uint32_t x;
+
+	ulTxTail += ulTxDMALength;
+	ulTxDMALength = 0;
+	prvStartTx();
+
+	if( ulTxHead == ulTxTail )
+	{
+		/* Release every task waiting in xSerialTxFlush(). */
+		for( x = 0; x < serTX_MAX_WAITERS; x++ )
+		{
+			if( xTxWaiters[ x ] != NULL )
+			{
+				vTaskNotifyGiveFromISR( xTxWaiters[ x ], pxHigherPriorityTaskWoken );
+				xTxWaiters[ x ] = NULL;
+			}
+		}
+
+		if( pxTxCompleteCallback != NULL )
+		{
+			pxTxCompleteCallback();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvConfigureBaud( uint32_t ulClock, uint32_t ulBaud )
+{
+eUSCI_UART_Config xConfig = xUARTConfig;
+
+	if( !serBAUD_VALID( ulClock, ulBaud ) )
+	{
+		return pdFAIL;
+	}
 
-	/* Enable the interrupt then wait for the byte to be sent.  The interrupt
-	will be disabled again in the ISR. */
-	MAP_UART_enableInterrupt( EUSCI_A0_BASE, EUSCI_A_UART_TRANSMIT_INTERRUPT );
-	ulTaskNotifyTake( pdTRUE, xMaxWaitTime );
+	xConfig.clockPrescalar = serBAUD_BRDIV( ulClock, ulBaud );
+	xConfig.firstModReg = serBAUD_UCBRF( ulClock, ulBaud );
+	xConfig.secondModReg = serBAUD_UCBRS_FOR( ulClock, ulBaud );
+	xConfig.overSampling = serBAUD_SAMPLING( ulClock, ulBaud );
+
+	/* Initialising the module holds it in reset, which also clears its
+	interrupt enables. */
+	MAP_UART_initModule( EUSCI_A0_BASE, &xConfig );
+	MAP_UART_enableModule( EUSCI_A0_BASE );
+	MAP_UART_clearInterruptFlag( EUSCI_A0_BASE, EUSCI_A_UART_RECEIVE_INTERRUPT );
+	MAP_UART_enableInterrupt( EUSCI_A0_BASE, EUSCI_A_UART_RECEIVE_INTERRUPT );
+	ulBaudRate = ulBaud;
 
 	return pdPASS;
 }
 /*-----------------------------------------------------------*/
 
+BaseType_t xSerialSetBaud( uint32_t ulBaud )
+{
+BaseType_t xReturn;
+
+	if( !serBAUD_VALID( MAP_CS_getSMCLK(), ulBaud ) )
+	{
+		return pdFAIL;
+	}
+
+	/* Let queued output go at the old rate, then wait for the last character
+	to leave the shift register. */
+	xSerialTxFlush( portMAX_DELAY );
+	while( MAP_UART_queryStatusFlags( EUSCI_A0_BASE, EUSCI_A_UART_BUSY ) != 0 )
+	{
+	}
+
+	taskENTER_CRITICAL();
+	{
+		xReturn = prvConfigureBaud( MAP_CS_getSMCLK(), ulBaud );
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSerialClockChanged( void )
+{
+	return xSerialSetBaud( ulBaudRate );
+}
+/*-----------------------------------------------------------*/
+
 void vSerialClose(xComPortHandle xPort)
 {
 	/* Not supported as not required by the demo application. */
@@ -209,48 +569,46 @@ uint_fast8_t xInterruptStatus;
 
 	if( ( xInterruptStatus & EUSCI_A_UART_RECEIVE_INTERRUPT_FLAG ) != 0x00 )
 	{
+		/* Note an overrun before reading RXBUF, which clears the flag. */
+		if( ( pxUARTA0->STATW & EUSCI_A_STATW_OE ) != 0 )
+		{
+			ulRxLost++;
+		}
+
 		/* Obtain the character. */
-		ucChar = MAP_UART_receiveData( EUSCI_A0_BASE );
-
-		/* Send the character to the queue.  Note the comments at the top of this
-		file with regards to the inefficiency of this method for anything other than
-		very low bandwidth communications.
-
-		If writing to the queue unblocks a task, and the unblocked task	has a
-		priority above the currently running task (the task that this interrupt
-		interrupted), then xHigherPriorityTaskWoken will be set	to pdTRUE inside the
-		xQueueSendFromISR() function.  xHigherPriorityTaskWoken is then passed to
-		portYIELD_FROM_ISR() at	the end of this interrupt handler to request a
-		context switch so the interrupt returns directly to the (higher priority)
-		unblocked task. */
-		xQueueSendFromISR( xRxQueue, &ucChar, &xHigherPriorityTaskWoken );
+		ucChar = ( uint8_t ) pxUARTA0->RXBUF;
+
+		/* Send the character to the stream buffer.  The reading task is only
+		unblocked once the trigger level is reached.
+
+		If writing to the stream buffer unblocks a task, and the unblocked task
+		has a priority above the currently running task (the task that this
+		interrupt interrupted), then xHigherPriorityTaskWoken will be set to pdTRUE
+		inside the xStreamBufferSendFromISR() function.  xHigherPriorityTaskWoken
+		is then passed to portYIELD_FROM_ISR() at the end of this interrupt handler
+		to request a context switch so the interrupt returns directly to the
+		(higher priority) unblocked task. */
+		if( xStreamBufferSendFromISR( xRxStream, &ucChar, sizeof( ucChar ), &xHigherPriorityTaskWoken ) == 0 )
+		{
+			ulRxLost++;
+		}
 	}
 
 	if( ( xInterruptStatus & EUSCI_A_UART_TRANSMIT_INTERRUPT_FLAG ) != 0x00 )
 	{
-		/* Are there more characters to transmit? */
-		pcStringStart++;
-		if( ( uint32_t ) pcStringStart < ( uint32_t ) pcStringEnd )
+		/* TXBUF is empty.  Either a single character sent without DMA has
+		moved on, or a block was waiting for TXBUF to empty. */
+		MAP_UART_disableInterrupt( EUSCI_A0_BASE, EUSCI_A_UART_TRANSMIT_INTERRUPT );
+		if( ulTxDMALength == 1UL )
 		{
-			/* This is probably quite a heavy wait function just for writing to
-			the Tx register.  An optimised design would probably replace this
-			with a simple register write. */
-			pxUARTA0->TXBUF = ( uint_fast8_t ) *pcStringStart;
+			prvTxDone( &xHigherPriorityTaskWoken );
 		}
 		else
 		{
-			/* No more characters to send.  Disable the interrupt and notify the
-			task, if the task is waiting. */
-			MAP_UART_disableInterrupt( EUSCI_A0_BASE, EUSCI_A_UART_TRANSMIT_INTERRUPT );
-			if( xTransmittingTask != NULL )
-			{
-				vTaskNotifyGiveFromISR( xTransmittingTask, &xHigherPriorityTaskWoken );
-				xTransmittingTask = NULL;
-			}
+			prvStartTx();
 		}
 	}
 
-
 	/* portYIELD_FROM_ISR() will request a context switch if executing this
 	interrupt handler caused a task to leave the blocked state, and the task
 	that left the blocked state has a higher priority than the currently running
@@ -258,8 +616,14 @@ uint_fast8_t xInterruptStatus;
 	to xSemaphoreGiveFromISR() and xQueueSendFromISR() within this function. */
 	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
 }
+/*-----------------------------------------------------------*/
 
+void vSerialTxDMA_Handler( void )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
 
-
-
+	MAP_DMA_clearInterruptFlag( serTX_DMA_CHANNEL );
+	prvTxDone( &xHigherPriorityTaskWoken );
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
 
@@ -0,0 +1,104 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Computes the eUSCI_A UART baud rate settings from the clock frequency and
+ * the wanted baud rate, following the algorithm in the MSP432P4xx family
+ * user's guide (section 24.3.10, "Setting a Baud Rate").  The same macros
+ * give compile time constants, for static eUSCI_UART_Config initialisers, or
+ * run time values, for when the clock changes.
+ *
+ * With N = clock / baud:
+ *   N >= 16 - oversampling mode, UCBRx = INT( N / 16 ), UCBRFx = INT( N ) % 16.
+ *   N < 16  - low frequency mode, UCBRx = INT( N ), UCBRFx = 0.
+ *   UCBRSx is looked up from the fractional part of N in both modes.
+ */
+
+#ifndef SERIAL_BAUD_H
+#define SERIAL_BAUD_H
+
+#include <stdint.h>
+
+/* The integer part of N, and the fractional part of N in units of 1/10000. */
+#define serBAUD_N( ulClock, ulBaud )		( ( uint32_t ) ( ulClock ) / ( uint32_t ) ( ulBaud ) )
+#define serBAUD_FRACTION( ulClock, ulBaud )	( ( uint32_t ) ( ( ( uint64_t ) ( ( uint32_t ) ( ulClock ) % ( uint32_t ) ( ulBaud ) ) * 10000ULL ) / ( uint32_t ) ( ulBaud ) ) )
+
+/* The eUSCI needs at least three clocks per bit. */
+#define serBAUD_VALID( ulClock, ulBaud )	( ( ( ulBaud ) != 0UL ) && ( serBAUD_N( ulClock, ulBaud ) >= 3UL ) && ( serBAUD_N( ulClock, ulBaud ) < 0x100000UL ) )
+
+#define serBAUD_OVERSAMPLE( ulClock, ulBaud )	( serBAUD_N( ulClock, ulBaud ) >= 16UL )
+
+/* UCBRSx for a fractional part of N given in units of 1/10000 (user's guide
+table 24-4).  The entry with the largest fraction not above ulFraction is
+used. */
+#define serBAUD_UCBRS( ulFraction )	\
+	( ( ulFraction ) >= 9288UL ? 0xFEU : ( ulFraction ) >= 9170UL ? 0xFDU :	\
+	  ( ulFraction ) >= 9004UL ? 0xFBU : ( ulFraction ) >= 8751UL ? 0xF7U :	\
+	  ( ulFraction ) >= 8572UL ? 0xEFU : ( ulFraction ) >= 8464UL ? 0xDFU :	\
+	  ( ulFraction ) >= 8333UL ? 0xBFU : ( ulFraction ) >= 8004UL ? 0xEEU :	\
+	  ( ulFraction ) >= 7861UL ? 0xEDU : ( ulFraction ) >= 7503UL ? 0xDDU :	\
+	  ( ulFraction ) >= 7147UL ? 0xBBU : ( ulFraction ) >= 7001UL ? 0xB7U :	\
+	  ( ulFraction ) >= 6667UL ? 0xD6U : ( ulFraction ) >= 6432UL ? 0xB6U :	\
+	  ( ulFraction ) >= 6254UL ? 0xB5U : ( ulFraction ) >= 6003UL ? 0xADU :	\
+	  ( ulFraction ) >= 5715UL ? 0x6BU : ( ulFraction ) >= 5002UL ? 0xAAU :	\
+	  ( ulFraction ) >= 4378UL ? 0x55U : ( ulFraction ) >= 4286UL ? 0x53U :	\
+	  ( ulFraction ) >= 4003UL ? 0x92U : ( ulFraction ) >= 3753UL ? 0x52U :	\
+	  ( ulFraction ) >= 3575UL ? 0x4AU : ( ulFraction ) >= 3335UL ? 0x49U :	\
+	  ( ulFraction ) >= 3000UL ? 0x25U : ( ulFraction ) >= 2503UL ? 0x44U :	\
+	  ( ulFraction ) >= 2224UL ? 0x22U : ( ulFraction ) >= 2147UL ? 0x21U :	\
+	  ( ulFraction ) >= 1670UL ? 0x11U : ( ulFraction ) >= 1430UL ? 0x20U :	\
+	  ( ulFraction ) >= 1252UL ? 0x10U : ( ulFraction ) >= 1001UL ? 0x08U :	\
+	  ( ulFraction ) >= 835UL  ? 0x04U : ( ulFraction ) >= 715UL  ? 0x02U :	\
+	  ( ulFraction ) >= 529UL  ? 0x01U : 0x00U )
+
+/* The eUSCI_UART_Config fields that depend on the clock and baud rate. */
+#define serBAUD_BRDIV( ulClock, ulBaud )	\
+	( serBAUD_OVERSAMPLE( ulClock, ulBaud ) ? ( serBAUD_N( ulClock, ulBaud ) / 16UL ) : serBAUD_N( ulClock, ulBaud ) )
+
+#define serBAUD_UCBRF( ulClock, ulBaud )	\
+	( serBAUD_OVERSAMPLE( ulClock, ulBaud ) ? ( serBAUD_N( ulClock, ulBaud ) % 16UL ) : 0UL )
+
+#define serBAUD_UCBRS_FOR( ulClock, ulBaud )	serBAUD_UCBRS( serBAUD_FRACTION( ulClock, ulBaud ) )
+
+#define serBAUD_SAMPLING( ulClock, ulBaud )	\
+	( serBAUD_OVERSAMPLE( ulClock, ulBaud ) ? EUSCI_A_UART_OVERSAMPLING_BAUDRATE_GENERATION : EUSCI_A_UART_LOW_FREQUENCY_BAUDRATE_GENERATION )
+
+/* A complete 8N1, LSB first, SMCLK sourced configuration. */
+#define serBAUD_UART_CONFIG( ulClock, ulBaud )	\
+{												\
+	EUSCI_A_UART_CLOCKSOURCE_SMCLK,				\
+	serBAUD_BRDIV( ulClock, ulBaud ),			\
+	serBAUD_UCBRF( ulClock, ulBaud ),			\
+	serBAUD_UCBRS_FOR( ulClock, ulBaud ),		\
+	EUSCI_A_UART_NO_PARITY,						\
+	EUSCI_A_UART_LSB_FIRST,						\
+	EUSCI_A_UART_ONE_STOP_BIT,					\
+	EUSCI_A_UART_MODE,							\
+	serBAUD_SAMPLING( ulClock, ulBaud )			\
+}
+
+#endif /* SERIAL_BAUD_H */
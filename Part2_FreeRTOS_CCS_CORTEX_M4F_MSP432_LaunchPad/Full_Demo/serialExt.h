@@ -0,0 +1,92 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Additions to the standard demo serial.h interface, implemented in serial.c.
+ */
+
+#ifndef SERIAL_EXT_H
+#define SERIAL_EXT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Copy up to xLength bytes into the transmit ring and return at once.  The
+ * return value is the number of bytes accepted, less than xLength if the ring
+ * is full.  Must not be called from an interrupt.
+ */
+size_t xSerialWrite( const void *pvData, size_t xLength );
+
+/*
+ * The number of bytes xSerialWrite() would accept now.  Another task writing
+ * in between can take some of them.
+ */
+size_t xSerialTxSpace( void );
+
+/*
+ * Wait up to xBlockTime for the transmit ring to empty.  Returns pdPASS if
+ * the ring has emptied since the call, so everything queued before it has
+ * been handed to the UART.  Several tasks can wait at once, the DMA interrupt
+ * releases them all.  Uses the task notification of the calling task.
+ */
+BaseType_t xSerialTxFlush( TickType_t xBlockTime );
+
+/*
+ * Read up to xLength received bytes into pvBuffer.  Waits up to xBlockTime for
+ * the first bytes, then returns once xLength bytes have arrived or the line
+ * has been idle for a few milliseconds.  Returns the number of bytes read.
+ */
+size_t xSerialRead( void *pvBuffer, size_t xLength, TickType_t xBlockTime );
+
+/*
+ * The number of received bytes lost to UART overruns or a full receive
+ * buffer since the port was opened.
+ */
+uint32_t ulSerialRxLost( void );
+
+/*
+ * Register a function called from the DMA interrupt each time the transmit
+ * ring becomes empty.  NULL removes it.
+ */
+void vSerialSetTxCallback( void ( *pxCallback )( void ) );
+
+/*
+ * Change the baud rate, worked out from the current SMCLK frequency.  Queued
+ * output is sent at the old rate first.  Returns pdFAIL, leaving the rate
+ * unchanged, if SMCLK is too slow for ulBaud.  Must not be called from an
+ * interrupt.
+ */
+BaseType_t xSerialSetBaud( uint32_t ulBaud );
+
+/*
+ * Call after changing SMCLK to reprogram the UART for the baud rate already in
+ * use.
+ */
+BaseType_t xSerialClockChanged( void );
+
+#endif /* SERIAL_EXT_H */
@@ -0,0 +1,227 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+	MULTI-PRODUCER SERIAL LOG.
+
+	Producers reserve space in ucLogRing by advancing ulLogReserve with a
+	compare-and-swap (LDREX/STREX, see CompareAndSwap() in CortexM.c), so
+	tasks and interrupts of any priority can log at the same time without a
+	lock.  Each record is a header word followed by the data, padded to a
+	multiple of four bytes so a header never straddles the end of the ring.
+	The producer copies its data then writes the header last, which commits
+	the record.
+
+	The drain task reads records in reservation order from ulLogRelease and
+	queues them with xSerialWrite(), like any other writer to the UART.  A
+	record whose header is not yet committed holds up the records after it
+	until its producer finishes.  Once sent, the record is zeroed and
+	ulLogRelease advanced, which returns the space to the producers.
+
+	Producers make no kernel calls, so they can be used from interrupts above
+	configMAX_SYSCALL_INTERRUPT_PRIORITY.  The drain task therefore polls the
+	ring every serLOG_DRAIN_PERIOD while it is empty.
+*/
+
+/* Standard includes. */
+#include <string.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Demo application includes. */
+#include "serialExt.h"
+#include "serialLog.h"
+#include "CortexM.h"
+
+/* The size of the log ring.  Must be a power of 2. */
+#define serLOG_RING_SIZE		( 1024UL )
+
+/* How often the drain task looks for new records when the ring is empty. */
+#define serLOG_DRAIN_PERIOD		( pdMS_TO_TICKS( 10UL ) )
+
+/* Set in a header once the record's data is in place. */
+#define serLOG_COMMITTED		( 0x80000000UL )
+#define serLOG_LENGTH_MASK		( 0x0000FFFFUL )
+
+/* The space a record of xLength bytes takes in the ring, header included. */
+#define serLOG_RECORD_SIZE( xLength )	( ( sizeof( uint32_t ) + ( xLength ) + 3UL ) & ~3UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that copies committed records to the UART.
+ */
+static void prvLogDrainTask( void *pvParameters );
+
+/*
+ * Atomically add ulValue to *pulCounter.
+ */
+static void prvAtomicAdd( volatile uint32_t *pulCounter, uint32_t ulValue );
+
+/*-----------------------------------------------------------*/
+
+/* The ring, word aligned so headers can be accessed as words.  Volatile so the
+data stores are not moved after the header store that commits them. */
+static volatile uint32_t ulLogRing[ serLOG_RING_SIZE / sizeof( uint32_t ) ];
+static volatile uint8_t * const pucLogRing = ( volatile uint8_t * ) ulLogRing;
+
+/* Free running byte indexes.  Space from ulLogRelease up to ulLogReserve is
+owned by records that are being written or waiting to be sent. */
+static volatile uint32_t ulLogReserve = 0, ulLogRelease = 0;
+
+/* Overflow counters. */
+static volatile uint32_t ulDroppedRecords = 0, ulDroppedBytes = 0;
+
+/*-----------------------------------------------------------*/
+
+void vSerialLogStart( UBaseType_t uxPriority )
+{
+	xTaskCreate( prvLogDrainTask, "Log", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSerialLogWrite( const void *pvData, size_t xLength )
+{
+const uint8_t *pucData = ( const uint8_t * ) pvData;
+uint32_t ulStart, ulSize, x;
+
+	if( ( xLength == 0 ) || ( xLength > serLOG_MAX_RECORD ) )
+	{
+		prvAtomicAdd( &ulDroppedRecords, 1UL );
+		prvAtomicAdd( &ulDroppedBytes, xLength );
+		return pdFAIL;
+	}
+
+	/* Reserve the space.  If another producer gets in between the read of
+	ulLogReserve and the swap, the swap fails and the reservation is tried
+	again from the new value. */
+	ulSize = serLOG_RECORD_SIZE( xLength );
+	do
+	{
+		ulStart = ulLogReserve;
+		if( ( ulStart + ulSize - ulLogRelease ) > serLOG_RING_SIZE )
+		{
+			prvAtomicAdd( &ulDroppedRecords, 1UL );
+			prvAtomicAdd( &ulDroppedBytes, xLength );
+			return pdFAIL;
+		}
+	} while( CompareAndSwap( &ulLogReserve, ulStart, ulStart + ulSize ) == 0 );
+
+	/* The space is now owned by this call alone. */
+	for( x = 0; x < xLength; x++ )
+	{
+		pucLogRing[ ( ulStart + sizeof( uint32_t ) + x ) & ( serLOG_RING_SIZE - 1UL ) ] = pucData[ x ];
+	}
+
+	/* Commit. */
+	ulLogRing[ ( ulStart & ( serLOG_RING_SIZE - 1UL ) ) / sizeof( uint32_t ) ] = serLOG_COMMITTED | ( uint32_t ) xLength;
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSerialLogPrint( const char *pcString )
+{
+	return xSerialLogWrite( pcString, strlen( pcString ) );
+}
+/*-----------------------------------------------------------*/
+
+void vSerialLogGetDropped( uint32_t *pulRecords, uint32_t *pulBytes )
+{
+	*pulRecords = ulDroppedRecords;
+	*pulBytes = ulDroppedBytes;
+}
+/*-----------------------------------------------------------*/
+
+static void prvAtomicAdd( volatile uint32_t *pulCounter, uint32_t ulValue )
+{
+uint32_t ulOld;
+
+	do
+	{
+		ulOld = *pulCounter;
+	} while( CompareAndSwap( pulCounter, ulOld, ulOld + ulValue ) == 0 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvLogDrainTask( void *pvParameters )
+{
+uint32_t ulHeader, ulOffset, ulLength, ulChunk, ulSize, x;
+size_t xSent;
+
+	/* Just to remove compiler warnings. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		ulOffset = ulLogRelease & ( serLOG_RING_SIZE - 1UL );
+		ulHeader = ulLogRing[ ulOffset / sizeof( uint32_t ) ];
+
+		if( ( ulHeader & serLOG_COMMITTED ) == 0 )
+		{
+			/* Empty, or the oldest record is still being written. */
+			vTaskDelay( serLOG_DRAIN_PERIOD );
+			continue;
+		}
+
+		/* Send the data, in two pieces if it wraps past the end of the ring.
+		The transmit ring is shared with the other users of xSerialWrite()
+		(the CLI, telemetry), so when it is full wait for it to drain.
+		xSerialTxFlush() releases every task waiting on it, so the wait
+		ends even if another task is flushing too. */
+		ulLength = ulHeader & serLOG_LENGTH_MASK;
+		ulOffset = ( ulOffset + sizeof( uint32_t ) ) & ( serLOG_RING_SIZE - 1UL );
+		while( ulLength > 0 )
+		{
+			ulChunk = serLOG_RING_SIZE - ulOffset;
+			if( ulChunk > ulLength )
+			{
+				ulChunk = ulLength;
+			}
+
+			xSent = xSerialWrite( ( const void * ) &pucLogRing[ ulOffset ], ulChunk );
+			if( xSent == 0 )
+			{
+				xSerialTxFlush( portMAX_DELAY );
+			}
+
+			ulOffset = ( ulOffset + xSent ) & ( serLOG_RING_SIZE - 1UL );
+			ulLength -= xSent;
+		}
+
+		/* Zero the record so stale data is never read as a header, then hand
+		the space back. */
+		ulSize = serLOG_RECORD_SIZE( ulHeader & serLOG_LENGTH_MASK );
+		for( x = 0; x < ulSize; x += sizeof( uint32_t ) )
+		{
+			ulLogRing[ ( ( ulLogRelease + x ) & ( serLOG_RING_SIZE - 1UL ) ) / sizeof( uint32_t ) ] = 0;
+		}
+		ulLogRelease += ulSize;
+	}
+}
@@ -0,0 +1,69 @@
+/*
+ * FreeRTOS Kernel V10.1.1
+ * Copyright (C) 2018 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/*
+ * Multi-producer logging channel.  Any task, or any interrupt, can add a
+ * record to a shared ring without blocking and without masking interrupts.
+ * A single low priority drain task copies committed records to the UART
+ * transmit ring, in the order they were reserved.  Other tasks may write
+ * to the UART as well, a record can then be split by their output.
+ */
+
+#ifndef SERIAL_LOG_H
+#define SERIAL_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* The largest record, in bytes, accepted by xSerialLogWrite(). */
+#define serLOG_MAX_RECORD		( 128UL )
+
+/*
+ * Create the drain task.  Records written before this is called are kept in
+ * the ring until the task runs.  xSerialPortInitMinimal() must have been
+ * called first.
+ */
+void vSerialLogStart( UBaseType_t uxPriority );
+
+/*
+ * Add xLength bytes to the log as one record.  Never blocks, and can be called
+ * from any task or interrupt.  Returns pdFAIL, and counts the record as
+ * dropped, if the ring is full or xLength is 0 or above serLOG_MAX_RECORD.
+ */
+BaseType_t xSerialLogWrite( const void *pvData, size_t xLength );
+
+/*
+ * As xSerialLogWrite() for a nul terminated string.
+ */
+BaseType_t xSerialLogPrint( const char *pcString );
+
+/*
+ * The number of records, and of bytes, dropped since start up.
+ */
+void vSerialLogGetDropped( uint32_t *pulRecords, uint32_t *pulBytes );
+
+#endif /* SERIAL_LOG_H */
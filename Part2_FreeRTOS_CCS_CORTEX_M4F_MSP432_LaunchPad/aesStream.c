@@ -0,0 +1,341 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        aesStream.c
+// Function:    AES-256 CTR and CBC over whole buffers with the AES256 accelerator
+
+// The driverlib calls handle one 16-byte block and poll the busy flag.
+// Here a job runs from the AES ready interrupt: each interrupt reads the
+// finished block, chains it (XOR with the input for CTR, with the
+// previous ciphertext for CBC decryption) and writes the next block, so
+// the task that started the job is free while the accelerator works.
+//
+// The accelerator can also run CBC by itself with DMA, but its DMA
+// triggers only reach channels 0 to 2 and channels 0 and 1 are taken by
+// the serial port and the wave player (see dmaTable.h).  Moving 16 bytes
+// in the interrupt costs far less than the block itself.
+//
+// The expanded key stays in the accelerator.  CBC decryption needs the
+// last round key instead, it is made once when the job changes from
+// encrypting to decrypting or the other way.
+
+#include <stdint.h>
+#include <string.h>
+#include "msp.h"
+#include "driverlib.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "aesStream.h"
+
+#define AES_KEY_NONE        0
+#define AES_KEY_ENCRYPT     1
+#define AES_KEY_DECRYPT     2
+
+void vAES_Handler( void );
+
+static SemaphoreHandle_t xAesFree;      // given while no job is running
+static uint8_t ucKey[AES_KEY_SIZE];
+static uint8_t ucKeyLoaded;             // AES_KEY_ value in the accelerator
+
+// The running job
+static struct {
+    const uint8_t *in;
+    uint8_t *out;
+    uint32_t left;                      // bytes still to produce
+    uint8_t *iv;
+    uint8_t chain[AES_BLOCK_SIZE];      // counter, or previous ciphertext
+    uint8_t block[AES_BLOCK_SIZE];      // ciphertext in the accelerator (CBC decryption)
+    int mode;
+    aes_done_t done;
+    void *arg;
+} xJob;
+static volatile uint8_t ucBusy;
+
+static void aes_put(const uint8_t *b){
+    uint32_t i;
+    for(i = 0; i < AES_BLOCK_SIZE; i += 2){
+        AES256->DIN = (uint16_t)b[i] | ((uint16_t)b[i + 1] << 8);
+    }
+}
+
+static void aes_get(uint8_t *b){
+    uint32_t i;
+    uint16_t x;
+    for(i = 0; i < AES_BLOCK_SIZE; i += 2){
+        x = HWREG16(&AES256->DOUT);     // declared write only in msp432p401r.h
+        b[i] = (uint8_t)x;
+        b[i + 1] = (uint8_t)(x >> 8);
+    }
+}
+
+// Load the key for encryption, or make the last round key for decryption
+static void aes_loadKey(uint8_t use){
+    uint32_t i;
+    AES256->CTL0 = AES256_CTL0_KL__256BIT |
+            ((use == AES_KEY_DECRYPT) ? AES256_CTL0_OP_2 : AES256_CTL0_OP_0);
+    for(i = 0; i < AES_KEY_SIZE; i += 2){
+        AES256->KEY = (uint16_t)ucKey[i] | ((uint16_t)ucKey[i + 1] << 8);
+    }
+    while(AES256->STAT & AES256_STAT_BUSY){
+    }                                   // key generation, decryption only
+    if(use == AES_KEY_DECRYPT){
+        AES256->CTL0 = AES256_CTL0_KL__256BIT | AES256_CTL0_OP_3;
+    }
+    ucKeyLoaded = use;
+}
+
+// Hand the next block of the job to the accelerator
+static void aes_next(void){
+    uint32_t i;
+    switch(xJob.mode){
+    case AES_CTR:
+        aes_put(xJob.chain);
+        for(i = AES_BLOCK_SIZE; i-- > 0; ){
+            if(++xJob.chain[i]) break;  // 128-bit big endian counter
+        }
+        break;
+    case AES_CBC_ENCRYPT:
+        for(i = 0; i < AES_BLOCK_SIZE; i++){
+            xJob.block[i] = xJob.in[i] ^ xJob.chain[i];
+        }
+        aes_put(xJob.block);
+        break;
+    default:
+        memcpy(xJob.block, xJob.in, AES_BLOCK_SIZE);    // in may be overwritten, see vAES_Handler
+        aes_put(xJob.block);
+        break;
+    }
+}
+
+// 1 if len can be done in mode
+static int aes_valid(int mode, uint32_t len){
+    if((mode < AES_CTR) || (mode > AES_CBC_DECRYPT) || (len == 0)){
+        return 0;
+    }
+    return (mode == AES_CTR) || ((len % AES_BLOCK_SIZE) == 0);
+}
+
+// Start a job, the caller has taken xAesFree
+static void aes_begin(int mode, uint8_t *iv, const void *in, void *out, uint32_t len,
+        aes_done_t done, void *arg){
+    uint8_t use = (mode == AES_CBC_DECRYPT) ? AES_KEY_DECRYPT : AES_KEY_ENCRYPT;
+    xJob.in = (const uint8_t *)in;
+    xJob.out = (uint8_t *)out;
+    xJob.left = len;
+    xJob.iv = iv;
+    memcpy(xJob.chain, iv, AES_BLOCK_SIZE);
+    xJob.mode = mode;
+    xJob.done = done;
+    xJob.arg = arg;
+    ucBusy = 1;
+    if(ucKeyLoaded != use){
+        aes_loadKey(use);
+    }
+    AES256->CTL0 &= ~(AES256_CTL0_RDYIFG | AES256_CTL0_ERRFG);
+    AES256->CTL0 |= AES256_CTL0_RDYIE;
+    aes_next();
+    BITBAND_PERI(AES256->STAT, AES256_STAT_KEYWR_OFS) = 1;  // use the loaded key, starts the block
+}
+
+int aes_start(int mode, uint8_t *iv, const void *in, void *out, uint32_t len,
+        aes_done_t done, void *arg){
+    if((aes_valid(mode, len) == 0) || (xSemaphoreTake(xAesFree, 0) != pdTRUE)){
+        return 0;
+    }
+    aes_begin(mode, iv, in, out, len, done, arg);
+    return 1;
+}
+
+// A block is ready
+void vAES_Handler( void )
+{
+    uint8_t out[AES_BLOCK_SIZE];
+    uint32_t i, n;
+    BaseType_t xWoken = pdFALSE;
+    aes_done_t done;
+    void *arg;
+
+    aes_get(out);                       // also clears the ready flag
+    if(ucBusy == 0) return;
+    n = (xJob.left < AES_BLOCK_SIZE) ? xJob.left : AES_BLOCK_SIZE;
+    switch(xJob.mode){
+    case AES_CTR:
+        for(i = 0; i < n; i++){
+            xJob.out[i] = xJob.in[i] ^ out[i];
+        }
+        break;
+    case AES_CBC_ENCRYPT:
+        memcpy(xJob.out, out, AES_BLOCK_SIZE);
+        memcpy(xJob.chain, out, AES_BLOCK_SIZE);
+        break;
+    default:
+        for(i = 0; i < AES_BLOCK_SIZE; i++){
+            xJob.out[i] = out[i] ^ xJob.chain[i];
+        }
+        memcpy(xJob.chain, xJob.block, AES_BLOCK_SIZE);
+        break;
+    }
+    xJob.in += n;
+    xJob.out += n;
+    xJob.left -= n;
+    if(xJob.left){
+        aes_next();
+        return;
+    }
+
+    AES256->CTL0 &= ~AES256_CTL0_RDYIE;
+    memcpy(xJob.iv, xJob.chain, AES_BLOCK_SIZE);
+    done = xJob.done;
+    arg = xJob.arg;
+    ucBusy = 0;
+    xSemaphoreGiveFromISR(xAesFree, &xWoken);
+    if(done){
+        done(arg);
+    }
+    portYIELD_FROM_ISR(xWoken);
+}
+
+// aes_crypt job finished, wake the task waiting for it
+static void aes_wake(void *arg){
+    BaseType_t xWoken = pdFALSE;
+    vTaskNotifyGiveFromISR((TaskHandle_t)arg, &xWoken);
+    portYIELD_FROM_ISR(xWoken);
+}
+
+int aes_crypt(int mode, uint8_t *iv, const void *in, void *out, uint32_t len){
+    if(len == 0){
+        return 1;
+    }
+    if(aes_valid(mode, len) == 0){
+        return 0;
+    }
+    xSemaphoreTake(xAesFree, portMAX_DELAY);
+    aes_begin(mode, iv, in, out, len, aes_wake, xTaskGetCurrentTaskHandle());
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    return 1;
+}
+
+int aes_busy(void){
+    return ucBusy;
+}
+
+void aes_setKey(const uint8_t *key){
+    xSemaphoreTake(xAesFree, portMAX_DELAY);
+    memcpy(ucKey, key, AES_KEY_SIZE);
+    ucKeyLoaded = AES_KEY_NONE;
+    xSemaphoreGive(xAesFree);
+}
+
+void aes_init(void){
+    AES256->CTL0 = AES256_CTL0_SWRST;
+    ucKeyLoaded = AES_KEY_NONE;
+    ucBusy = 0;
+    xAesFree = xSemaphoreCreateBinary();
+    configASSERT(xAesFree);
+    xSemaphoreGive(xAesFree);
+    MAP_Interrupt_setPriority(INT_AES256, configKERNEL_INTERRUPT_PRIORITY);
+    MAP_Interrupt_enableInterrupt(INT_AES256);
+}
+
+#ifdef AES_SELFTEST
+// NIST SP 800-38A, AES-256 examples, see tools/aes_kat.py -c
+static const uint8_t ucKatKey[32] = {
+    0x60, 0x3D, 0xEB, 0x10, 0x15, 0xCA, 0x71, 0xBE, 0x2B, 0x73, 0xAE, 0xF0, 0x85, 0x7D, 0x77, 0x81,
+    0x1F, 0x35, 0x2C, 0x07, 0x3B, 0x61, 0x08, 0xD7, 0x2D, 0x98, 0x10, 0xA3, 0x09, 0x14, 0xDF, 0xF4
+};
+static const uint8_t ucKatPlain[64] = {
+    0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+    0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C, 0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+    0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11, 0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+    0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17, 0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10
+};
+static const uint8_t ucKatCbcIV[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F
+};
+static const uint8_t ucKatCbcCipher[64] = {
+    0xF5, 0x8C, 0x4C, 0x04, 0xD6, 0xE5, 0xF1, 0xBA, 0x77, 0x9E, 0xAB, 0xFB, 0x5F, 0x7B, 0xFB, 0xD6,
+    0x9C, 0xFC, 0x4E, 0x96, 0x7E, 0xDB, 0x80, 0x8D, 0x67, 0x9F, 0x77, 0x7B, 0xC6, 0x70, 0x2C, 0x7D,
+    0x39, 0xF2, 0x33, 0x69, 0xA9, 0xD9, 0xBA, 0xCF, 0xA5, 0x30, 0xE2, 0x63, 0x04, 0x23, 0x14, 0x61,
+    0xB2, 0xEB, 0x05, 0xE2, 0xC3, 0x9B, 0xE9, 0xFC, 0xDA, 0x6C, 0x19, 0x07, 0x8C, 0x6A, 0x9D, 0x1B
+};
+static const uint8_t ucKatCtrIV[16] = {
+    0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
+};
+static const uint8_t ucKatCtrCipher[64] = {
+    0x60, 0x1E, 0xC3, 0x13, 0x77, 0x57, 0x89, 0xA5, 0xB7, 0xA7, 0xF5, 0x04, 0xBB, 0xF3, 0xD2, 0x28,
+    0xF4, 0x43, 0xE3, 0xCA, 0x4D, 0x62, 0xB5, 0x9A, 0xCA, 0x84, 0xE9, 0x90, 0xCA, 0xCA, 0xF5, 0xC5,
+    0x2B, 0x09, 0x30, 0xDA, 0xA2, 0x3D, 0xE9, 0x4C, 0xE8, 0x70, 0x17, 0xBA, 0x2D, 0x84, 0x98, 0x8D,
+    0xDF, 0xC9, 0xC5, 0x8D, 0xB6, 0x7A, 0xAD, 0xA6, 0x13, 0xC2, 0xDD, 0x08, 0x45, 0x79, 0x41, 0xA6
+};
+
+// Run one vector: whole, in two pieces, in place.  1 if all match
+static int aes_kat(int mode, const uint8_t *iv, const uint8_t *in, const uint8_t *want){
+    uint8_t buf[64];
+    uint8_t v[AES_BLOCK_SIZE];
+    memcpy(v, iv, AES_BLOCK_SIZE);
+    aes_crypt(mode, v, in, buf, 64);
+    if(memcmp(buf, want, 64)) return 0;
+    memcpy(v, iv, AES_BLOCK_SIZE);
+    aes_crypt(mode, v, in, buf, 16);
+    aes_crypt(mode, v, in + 16, buf + 16, 48);
+    if(memcmp(buf, want, 64)) return 0;
+    memcpy(v, iv, AES_BLOCK_SIZE);
+    memcpy(buf, in, 64);
+    aes_crypt(mode, v, buf, buf, 64);
+    return memcmp(buf, want, 64) == 0;
+}
+
+int aes_selfTest(void){
+    uint8_t buf[23];
+    uint8_t v[AES_BLOCK_SIZE];
+    int ok;
+    aes_setKey(ucKatKey);
+    ok = aes_kat(AES_CBC_ENCRYPT, ucKatCbcIV, ucKatPlain, ucKatCbcCipher) &&
+         aes_kat(AES_CBC_DECRYPT, ucKatCbcIV, ucKatCbcCipher, ucKatPlain) &&
+         aes_kat(AES_CTR, ucKatCtrIV, ucKatPlain, ucKatCtrCipher) &&
+         aes_kat(AES_CTR, ucKatCtrIV, ucKatCtrCipher, ucKatPlain);
+    memcpy(v, ucKatCtrIV, AES_BLOCK_SIZE);
+    aes_crypt(AES_CTR, v, ucKatPlain, buf, sizeof(buf));    // partial last block
+    return ok && (memcmp(buf, ucKatCtrCipher, sizeof(buf)) == 0);
+}
+#endif
@@ -0,0 +1,141 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        aesStream.h
+// Function:    header file of aesStream.c
+
+#ifndef AESSTREAM_H_
+#define AESSTREAM_H_
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+
+#define AES_BLOCK_SIZE      16
+#define AES_KEY_SIZE        32      // AES-256 only
+
+// Modes of aes_start and aes_crypt
+#define AES_CTR             0       // counter mode, encrypt and decrypt are the same
+#define AES_CBC_ENCRYPT     1
+#define AES_CBC_DECRYPT     2
+
+// Called from the AES interrupt when a job has finished
+typedef void (*aes_done_t)(void *arg);
+
+/**
+ * Set up the AES256 accelerator, its interrupt and the semaphore
+ * that hands the accelerator from one job to the next
+ *
+ * @param  none
+ * @return none
+ * @note   Call before vTaskStartScheduler
+ * @brief  Initialize the AES engine
+ */
+void aes_init(void);
+
+/**
+ * Set the AES-256 key used by the jobs that follow
+ *
+ * @param  key is 32 bytes, copied
+ * @return none
+ * @note   Waits for a running job to finish.  Call from a task
+ * @brief  Set the cipher key
+ */
+void aes_setKey(const uint8_t *key);
+
+/**
+ * Start encrypting or decrypting a buffer in the background
+ *
+ * @param  mode is AES_CTR, AES_CBC_ENCRYPT or AES_CBC_DECRYPT
+ * @param  iv is 16 bytes: the counter block for CTR, the chaining
+ *         value for CBC.  When the job finishes it holds the value for
+ *         the next piece of the same message
+ * @param  in is the input, any alignment
+ * @param  out is the output, may be the same buffer as in
+ * @param  len is the number of bytes, not 0, a multiple of 16 for CBC.
+ *         In CTR only the last piece of a message may be shorter
+ * @param  done is called from the AES interrupt when the job has
+ *         finished, or NULL
+ * @param  arg is passed to done
+ * @return 1 if the job started, 0 if the accelerator is busy or
+ *         len is not valid for the mode
+ * @note   iv, in and out must stay valid until done is called.  Returns
+ *         right away.  Call from a task, not from an ISR
+ * @brief  Start an AES job
+ */
+int aes_start(int mode, uint8_t *iv, const void *in, void *out, uint32_t len,
+        aes_done_t done, void *arg);
+
+/**
+ * Encrypt or decrypt a buffer, the calling task blocks until it is done
+ *
+ * @param  mode, iv, in, out and len as aes_start
+ * @return 1 when done (at once if len is 0), 0 if len is not valid
+ *         for the mode
+ * @note   Waits for the accelerator if another job is running
+ * @brief  AES job, blocking
+ */
+int aes_crypt(int mode, uint8_t *iv, const void *in, void *out, uint32_t len);
+
+/**
+ * Check whether a job is running
+ *
+ * @param  none
+ * @return 1 while a job is running, 0 when the accelerator is free
+ * @brief  AES busy flag
+ */
+int aes_busy(void);
+
+#ifdef AES_SELFTEST
+/**
+ * Run the AES-256 CBC and CTR examples of NIST SP 800-38A on the
+ * accelerator, whole, streamed in two pieces and in place
+ *
+ * @param  none
+ * @return 1 if every result matches, 0 if not
+ * @note   Sets the example key, call aes_setKey again afterwards.
+ *         tools/aes_kat.py runs the same vectors on the host
+ * @brief  AES known-answer test
+ */
+int aes_selfTest(void);
+#endif
+
+#endif
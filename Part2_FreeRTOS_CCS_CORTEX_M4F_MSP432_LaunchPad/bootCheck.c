@@ -0,0 +1,205 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// LED1 connected to P1.0
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        bootCheck.c
+// Function:    Verify the application image in MAIN flash before main runs
+
+// tools/image_crc.py writes a CRC-32 for every 4kB sector of the image
+// into the trailer at BOOT_TRAILER_ADDR after linking.  Before the C run
+// time starts, resetISR calls bootCheck_image, which raises MCLK to 12MHz
+// and feeds the image to the CRC32 module straight from flash, four
+// words per loop pass.  bootCheck_status gives the cycles the check
+// took, main_full logs them on the UART at start up.
+//
+// bootRecord lives in RAM that the C run time does not clear.  Once a
+// check passes it remembers the trailer, so a warm reset (watchdog,
+// software or pin reset, with RAM intact) only checks the trailer itself
+// and the sectors marked dirty since.
+
+#include <stdint.h>
+#include "msp.h"
+#include "bootCheck.h"
+
+#define BOOT_RECORD_MAGIC   0x424F4F54
+
+typedef struct {
+    uint32_t magic;             // BOOT_RECORD_MAGIC
+    uint32_t trailerCrc;        // trailer checked by the last full check
+    uint32_t dirty[2];          // sectors to check at the next reset
+    uint32_t status;            // BOOT_OK_ result of this boot
+    uint32_t cycles;            // CPU cycles of this boot's check
+    uint32_t check;             // ~(magic ^ trailerCrc ^ dirty[0] ^ dirty[1])
+} bootRecord_t;
+
+// The trailer is patched by tools/image_crc.py after linking, so the
+// compiler must not use the placeholder it was initialized with: it is
+// const volatile and only read through volatile pointers
+#if defined(__TI_COMPILER_VERSION__)
+#pragma DATA_SECTION(bootTrailer, ".imageTrailer")
+#pragma RETAIN(bootTrailer)
+const volatile bootTrailer_t bootTrailer = { BOOT_UNSIGNED };
+#pragma NOINIT(bootRecord)
+static bootRecord_t bootRecord;
+#elif defined(__GNUC__)
+const volatile bootTrailer_t bootTrailer __attribute__((section(".imageTrailer"), used)) = { BOOT_UNSIGNED };
+static bootRecord_t bootRecord __attribute__((section(".noinit")));
+#endif
+
+// CRC-32 (as zlib) of len bytes of word aligned flash, len a multiple of 4
+static uint32_t boot_crc(const volatile uint32_t *p, uint32_t len){
+    uint32_t a, b, c, d;
+    uint32_t words = len/4;
+    CRC32->INIRES32_LO = 0xFFFF;
+    CRC32->INIRES32_HI = 0xFFFF;
+    while(words >= 4){
+        a = p[0]; b = p[1]; c = p[2]; d = p[3];
+        CRC32->DI32 = (uint16_t)a; CRC32->DI32 = (uint16_t)(a >> 16);
+        CRC32->DI32 = (uint16_t)b; CRC32->DI32 = (uint16_t)(b >> 16);
+        CRC32->DI32 = (uint16_t)c; CRC32->DI32 = (uint16_t)(c >> 16);
+        CRC32->DI32 = (uint16_t)d; CRC32->DI32 = (uint16_t)(d >> 16);
+        p += 4;
+        words -= 4;
+    }
+    while(words){
+        a = *p++;
+        CRC32->DI32 = (uint16_t)a; CRC32->DI32 = (uint16_t)(a >> 16);
+        words--;
+    }
+    return (((uint32_t)CRC32->RESR32_HI << 16) | CRC32->RESR32_LO)^0xFFFFFFFF;
+}
+
+static uint32_t boot_record_check(const bootRecord_t *r){
+    return ~(r->magic ^ r->trailerCrc ^ r->dirty[0] ^ r->dirty[1]);
+}
+
+// The image is bad, stop with LED1 on and the motor pins still inputs
+static void boot_fail(void){
+    __disable_irq();
+    P1->DIR |= 0x01;
+    P1->OUT |= 0x01;
+    for(;;){
+    }
+}
+
+// 1 if sector s matches the trailer
+static int boot_sector(const volatile bootTrailer_t *t, uint32_t s){
+    uint32_t start = s*BOOT_SECTOR_SIZE;
+    uint32_t len = t->length - start;
+    if(len > BOOT_SECTOR_SIZE) len = BOOT_SECTOR_SIZE;
+    return boot_crc((const volatile uint32_t *)start, len) == t->sectorCrc[s];
+}
+
+void bootCheck_image(void){
+    const volatile bootTrailer_t *t = &bootTrailer;
+    bootRecord_t *r = &bootRecord;
+    uint32_t ctl0, start, s, status;
+    int warm;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    start = DWT->CYCCNT;
+
+    if(t->magic == BOOT_UNSIGNED){
+        r->magic = 0;                           // nothing to remember
+        r->status = BOOT_OK_UNSIGNED;
+        r->cycles = DWT->CYCCNT - start;
+        return;
+    }
+
+    // 12MHz from the DCO, fine at VCORE0 with no flash wait states
+    CS->KEY = CS_KEY_VAL;
+    ctl0 = CS->CTL0;
+    CS->CTL0 = (ctl0 & ~CS_CTL0_DCORSEL_MASK) | CS_CTL0_DCORSEL_3;
+
+    if((t->magic != BOOT_SIGNED) || (t->sectors > BOOT_MAX_SECTORS) ||
+       (t->length > t->sectors*BOOT_SECTOR_SIZE) || (t->length & 3) ||
+       (boot_crc((const volatile uint32_t *)t, sizeof(bootTrailer_t) - 4) != t->trailerCrc)){
+        boot_fail();
+    }
+
+    warm = (r->magic == BOOT_RECORD_MAGIC) && (r->check == boot_record_check(r)) &&
+           (r->trailerCrc == t->trailerCrc);
+    for(s = 0; s < t->sectors; s++){
+        if(warm && ((r->dirty[s/32] & (1u << (s%32))) == 0)){
+            continue;                           // unchanged since it was last checked
+        }
+        if(boot_sector(t, s) == 0){
+            r->magic = 0;
+            boot_fail();
+        }
+    }
+    status = warm ? BOOT_OK_FAST : BOOT_OK_FULL;
+
+    CS->CTL0 = ctl0;                            // back to the reset clock
+    CS->KEY = 0;
+
+    r->magic = BOOT_RECORD_MAGIC;
+    r->trailerCrc = t->trailerCrc;
+    r->dirty[0] = 0;
+    r->dirty[1] = 0;
+    r->check = boot_record_check(r);
+    r->status = status;
+    r->cycles = DWT->CYCCNT - start;
+}
+
+uint32_t bootCheck_status(uint32_t *cycles){
+    if(cycles){
+        *cycles = bootRecord.cycles;
+    }
+    return bootRecord.status;
+}
+
+void bootCheck_markDirty(uint32_t addr, uint32_t len){
+    uint32_t s, last;
+    if((len == 0) || (addr >= BOOT_TRAILER_ADDR) || (bootRecord.magic != BOOT_RECORD_MAGIC)){
+        return;
+    }
+    last = (addr + len - 1)/BOOT_SECTOR_SIZE;
+    if(last >= BOOT_MAX_SECTORS) last = BOOT_MAX_SECTORS - 1;
+    for(s = addr/BOOT_SECTOR_SIZE; s <= last; s++){
+        bootRecord.dirty[s/32] |= 1u << (s%32);
+    }
+    bootRecord.check = boot_record_check(&bootRecord);
+}
@@ -0,0 +1,110 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        bootCheck.h
+// Function:    header file of bootCheck.c
+
+#ifndef BOOTCHECK_H_
+#define BOOTCHECK_H_
+
+#include <stdint.h>
+
+// The image is checked in flash sectors, the trailer has the last sector
+#define BOOT_SECTOR_SIZE    4096
+#define BOOT_TRAILER_ADDR   0x0003F000
+#define BOOT_MAX_SECTORS    (BOOT_TRAILER_ADDR/BOOT_SECTOR_SIZE)
+
+// Trailer magic numbers
+#define BOOT_UNSIGNED       0x554E5347      // as linked, tools/image_crc.py not run
+#define BOOT_SIGNED         0x43524332      // filled in by tools/image_crc.py
+
+// Written by tools/image_crc.py after linking, must match the script
+typedef struct {
+    uint32_t magic;                         // BOOT_SIGNED or BOOT_UNSIGNED
+    uint32_t length;                        // image bytes from address 0, multiple of 4
+    uint32_t sectors;                       // sector CRCs in use
+    uint32_t sectorCrc[BOOT_MAX_SECTORS];   // CRC-32 of each sector of the image
+    uint32_t trailerCrc;                    // CRC-32 of all of the above
+} bootTrailer_t;
+
+// Results of bootCheck_image
+#define BOOT_OK_FULL        1   // every sector checked
+#define BOOT_OK_FAST        2   // warm reset, trailer and dirty sectors checked
+#define BOOT_OK_UNSIGNED    3   // no trailer, not checked (development build)
+
+/**
+ * Check the application image against its trailer
+ *
+ * @param  none
+ * @return none
+ * @note   Called by resetISR before the C run time is set up, so it
+ *         uses no initialized data.  After a power up every sector is
+ *         checked.  After a warm reset, with the record in no-init RAM
+ *         still valid for this trailer, only the trailer and sectors
+ *         marked with bootCheck_markDirty are.  On a mismatch LED1
+ *         (P1.0) is turned on and the CPU stops, main never runs
+ * @brief  Boot time image verification
+ */
+void bootCheck_image(void);
+
+/**
+ * Result of the check made at this boot
+ *
+ * @param  cycles receives the CPU cycles the check took, may be NULL
+ * @return BOOT_OK_FULL, BOOT_OK_FAST or BOOT_OK_UNSIGNED
+ * @note   The check runs with MCLK at 12MHz
+ * @brief  Boot check status
+ */
+uint32_t bootCheck_status(uint32_t *cycles);
+
+/**
+ * Mark image flash as rewritten, so the next warm reset checks it
+ *
+ * @param  addr is the first address written
+ * @param  len is the number of bytes written
+ * @return none
+ * @note   For code that reprograms the application image in place
+ * @brief  Force a sector check on the next reset
+ */
+void bootCheck_markDirty(uint32_t addr, uint32_t len);
+
+#endif
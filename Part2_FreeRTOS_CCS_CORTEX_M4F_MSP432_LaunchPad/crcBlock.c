@@ -0,0 +1,231 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        crcBlock.c
+// Function:    CRC-32 and CRC-16 of whole buffers with the CRC32 module
+
+// The driverlib calls take one 8, 16 or 32 bit value each, and
+// CRC32_set32BitData splits its word into two 16-bit writes anyway.
+// Here the data registers are written directly: a loop unrolled to
+// eight bytes per pass for small blocks, and DMA channel 7 in auto mode
+// (software request, 16-bit items) for large ones.  An odd byte at
+// either end is written on its own.
+//
+// The module holds one computation at a time, so a mutex guards it.
+// Callers that cannot take the mutex (interrupts, the scheduler not
+// started, or another task using the module) get the same result from
+// the slice-by-8 software CRC in crcSoft.c.
+
+#include <stdint.h>
+#include "msp.h"
+#include "driverlib.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "dmaTable.h"
+#include "crcSoft.h"
+#include "crcBlock.h"
+
+#define CRC_CHANNEL     7
+#define CRC_DMA_MAX     1024            // items per DMA transfer
+
+static SemaphoreHandle_t xCrcMutex;
+
+// DMA control words for 8 and 16-bit items into a fixed register
+#define CRC_DMA_16  (UDMA_SIZE_16 | UDMA_SRC_INC_16 | UDMA_DST_INC_NONE | UDMA_ARB_8)
+#define CRC_DMA_8   (UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_8)
+
+// Mirror the bits of a word, seeds and results of the CRC-32 module are
+// bit reversed compared with the zlib convention
+static uint32_t crc_reflect(uint32_t x){
+    x = ((x >> 1) & 0x55555555) | ((x & 0x55555555) << 1);
+    x = ((x >> 2) & 0x33333333) | ((x & 0x33333333) << 2);
+    x = ((x >> 4) & 0x0F0F0F0F) | ((x & 0x0F0F0F0F) << 4);
+    x = ((x >> 8) & 0x00FF00FF) | ((x & 0x00FF00FF) << 8);
+    return (x >> 16) | (x << 16);
+}
+
+// Move len items from src to a CRC data register with DMA and wait
+static void crc_dma(const void *src, volatile void *dst, uint32_t len, uint32_t control, uint32_t size){
+    const uint8_t *p = (const uint8_t *)src;
+    uint32_t n;
+    MAP_DMA_setChannelControl(UDMA_PRI_SELECT | CRC_CHANNEL, control);
+    while(len){
+        n = (len > CRC_DMA_MAX) ? CRC_DMA_MAX : len;
+        MAP_DMA_setChannelTransfer(UDMA_PRI_SELECT | CRC_CHANNEL, UDMA_MODE_AUTO,
+                (void *)p, (void *)dst, n);
+        MAP_DMA_enableChannel(CRC_CHANNEL);
+        MAP_DMA_requestSoftwareTransfer(CRC_CHANNEL);
+        while(MAP_DMA_isChannelEnabled(CRC_CHANNEL)){
+        }                               // the channel turns itself off when done
+        p += n*size;
+        len -= n;
+    }
+    MAP_DMA_clearInterruptFlag(CRC_CHANNEL);
+}
+
+// Feed the CRC-32 module, 16 bits at a time, low byte first
+static void crc32_feed(const uint8_t *p, uint32_t len, int useDma){
+    const uint16_t *w;
+    uint32_t n;
+    if(len && ((uint32_t)p & 1)){
+        HWREG8(&CRC32->DI32) = *p++;
+        len--;
+    }
+    w = (const uint16_t *)p;
+    n = len/2;
+    if(useDma){
+        crc_dma(w, &CRC32->DI32, n, CRC_DMA_16, 2);
+        w += n;
+    }else{
+        while(n >= 4){
+            CRC32->DI32 = w[0];
+            CRC32->DI32 = w[1];
+            CRC32->DI32 = w[2];
+            CRC32->DI32 = w[3];
+            w += 4;
+            n -= 4;
+        }
+        while(n){
+            CRC32->DI32 = *w++;
+            n--;
+        }
+    }
+    if(len & 1){
+        HWREG8(&CRC32->DI32) = *(const uint8_t *)w;
+    }
+}
+
+// Feed the CRC-16 module a byte at a time through the bit reversed input,
+// which gives the MSB first CCITT result
+static void crc16_feed(const uint8_t *p, uint32_t len, int useDma){
+    if(useDma){
+        crc_dma(p, &CRC32->DIRB16, len, CRC_DMA_8, 1);
+        return;
+    }
+    while(len >= 8){
+        HWREG8(&CRC32->DIRB16) = p[0];
+        HWREG8(&CRC32->DIRB16) = p[1];
+        HWREG8(&CRC32->DIRB16) = p[2];
+        HWREG8(&CRC32->DIRB16) = p[3];
+        HWREG8(&CRC32->DIRB16) = p[4];
+        HWREG8(&CRC32->DIRB16) = p[5];
+        HWREG8(&CRC32->DIRB16) = p[6];
+        HWREG8(&CRC32->DIRB16) = p[7];
+        p += 8;
+        len -= 8;
+    }
+    while(len){
+        HWREG8(&CRC32->DIRB16) = *p++;
+        len--;
+    }
+}
+
+// Take the module, 0 if the software CRC has to be used instead
+static int crc_take(void){
+    if((xCrcMutex == NULL) || (SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk) ||
+       (xTaskGetSchedulerState() != taskSCHEDULER_RUNNING)){
+        return 0;
+    }
+    return xSemaphoreTake(xCrcMutex, 0) == pdTRUE;
+}
+
+static uint32_t crc32_hw(uint32_t crc, const uint8_t *p, uint32_t len, int useDma){
+    MAP_CRC32_setSeed(crc_reflect(~crc), CRC32_MODE);
+    crc32_feed(p, len, useDma);
+    return MAP_CRC32_getResultReversed(CRC32_MODE)^0xFFFFFFFF;
+}
+
+uint32_t crc32_update(uint32_t crc, const void *buf, uint32_t len){
+    if(crc_take() == 0){
+        return crcSoft_crc32(crc, buf, len);
+    }
+    crc = crc32_hw(crc, (const uint8_t *)buf, len, len >= CRC_DMA_MIN);
+    xSemaphoreGive(xCrcMutex);
+    return crc;
+}
+
+uint32_t crc32_compute(const void *buf, uint32_t len){
+    return crc32_update(0, buf, len);
+}
+
+uint16_t crc16_compute(const void *buf, uint32_t len){
+    uint16_t crc;
+    if(crc_take() == 0){
+        return crcSoft_crc16(0xFFFF, buf, len);
+    }
+    MAP_CRC32_setSeed(0xFFFF, CRC16_MODE);
+    crc16_feed((const uint8_t *)buf, len, len >= CRC_DMA_MIN);
+    crc = (uint16_t)MAP_CRC32_getResult(CRC16_MODE);
+    xSemaphoreGive(xCrcMutex);
+    return crc;
+}
+
+void crc_init(void){
+    dmaTable_init();
+    MAP_DMA_assignChannel(DMA_CH7_RESERVED0);   // no trigger, software requests only
+    MAP_DMA_disableChannelAttribute(CRC_CHANNEL, UDMA_ATTR_ALTSELECT |
+            UDMA_ATTR_USEBURST | UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+    xCrcMutex = xSemaphoreCreateMutex();
+    configASSERT(xCrcMutex);
+}
+
+#ifdef CRC_BENCHMARK
+int crc_benchmark(const void *buf, uint32_t len, crc_bench_t *result){
+    uint32_t start, soft, cpu, dma;
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    result->bytes = len;
+    start = DWT->CYCCNT;
+    soft = crcSoft_crc32(0, buf, len);
+    result->soft = DWT->CYCCNT - start;
+    xSemaphoreTake(xCrcMutex, portMAX_DELAY);
+    start = DWT->CYCCNT;
+    cpu = crc32_hw(0, (const uint8_t *)buf, len, 0);
+    result->cpu = DWT->CYCCNT - start;
+    start = DWT->CYCCNT;
+    dma = crc32_hw(0, (const uint8_t *)buf, len, 1);
+    result->dma = DWT->CYCCNT - start;
+    xSemaphoreGive(xCrcMutex);
+    return (soft == cpu) && (cpu == dma);
+}
+#endif
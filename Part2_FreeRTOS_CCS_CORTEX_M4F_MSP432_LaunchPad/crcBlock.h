@@ -0,0 +1,126 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        crcBlock.h
+// Function:    header file of crcBlock.c
+
+#ifndef CRCBLOCK_H_
+#define CRCBLOCK_H_
+
+#include <stdint.h>
+
+// Blocks of at least this many bytes are fed to the CRC module by DMA,
+// smaller ones by the CPU
+#define CRC_DMA_MIN     256
+
+/**
+ * Set up the DMA channel that feeds the CRC module and the mutex
+ * that shares the module between tasks
+ *
+ * @param  none
+ * @return none
+ * @note   Call before vTaskStartScheduler.  Until it runs the functions
+ *         below use the software CRC
+ * @brief  Initialize the block CRC
+ */
+void crc_init(void);
+
+/**
+ * CRC-32 (IEEE 802.3, as zlib crc32) of a buffer
+ *
+ * @param  crc is 0 to start, or the result of the previous call
+ *         to continue over more data
+ * @param  buf is the data, any alignment
+ * @param  len is the number of bytes
+ * @return the CRC of all the data so far
+ * @note   Uses the CRC module, by DMA for blocks of CRC_DMA_MIN bytes
+ *         or more.  From an interrupt, or while another task has the
+ *         module, the result comes from crcSoft_crc32 instead
+ * @brief  Block CRC-32
+ */
+uint32_t crc32_update(uint32_t crc, const void *buf, uint32_t len);
+
+/**
+ * CRC-32 of one buffer, crc32_update starting from 0
+ *
+ * @param  buf is the data
+ * @param  len is the number of bytes
+ * @return the CRC
+ * @brief  Block CRC-32
+ */
+uint32_t crc32_compute(const void *buf, uint32_t len);
+
+/**
+ * CRC-16/CCITT (polynomial 0x1021, seed 0xFFFF, no final XOR) of a buffer
+ *
+ * @param  buf is the data
+ * @param  len is the number of bytes
+ * @return the CRC
+ * @note   Same paths as crc32_update
+ * @brief  Block CRC-16
+ */
+uint16_t crc16_compute(const void *buf, uint32_t len);
+
+#ifdef CRC_BENCHMARK
+// Cycles taken by each path over the same buffer, filled in by crc_benchmark
+typedef struct {
+    uint32_t bytes;
+    uint32_t soft;      // crcSoft_crc32
+    uint32_t cpu;       // CRC module fed by the CPU
+    uint32_t dma;       // CRC module fed by DMA
+} crc_bench_t;
+
+/**
+ * Time the three CRC-32 paths on a buffer
+ *
+ * @param  buf is the data
+ * @param  len is the number of bytes
+ * @param  result receives the cycle counts
+ * @return 1 if the three paths agree, 0 if not
+ * @note   Bytes per cycle is result->bytes/result->soft and so on.
+ *         Uses the DWT cycle counter, call from a task
+ * @brief  CRC benchmark
+ */
+int crc_benchmark(const void *buf, uint32_t len, crc_bench_t *result);
+#endif
+
+#endif
@@ -0,0 +1,83 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        crcSoft.h
+// Function:    header file of crcSoft.c
+
+#ifndef CRCSOFT_H_
+#define CRCSOFT_H_
+
+#include <stdint.h>
+
+// Plain C, no hardware, so it also builds on a PC:
+//   gcc -O2 crcSoft.c crcTable.c yourprogram.c
+
+extern const uint32_t crcSoft_table32[8][256];
+extern const uint16_t crcSoft_table16[256];
+
+/**
+ * CRC-32 (IEEE 802.3, as zlib crc32) in software, slice-by-8
+ *
+ * @param  crc is 0 to start, or the result of the previous call
+ *         to continue over more data
+ * @param  buf is the data, any alignment
+ * @param  len is the number of bytes
+ * @return the CRC of all the data so far
+ * @note   Gives the same result as crc32_compute in crcBlock.c
+ * @brief  Software CRC-32
+ */
+uint32_t crcSoft_crc32(uint32_t crc, const void *buf, uint32_t len);
+
+/**
+ * CRC-16/CCITT (polynomial 0x1021, MSB first, no final XOR)
+ * in software, one table lookup per byte
+ *
+ * @param  crc is 0xFFFF to start, or the result of the previous call
+ * @param  buf is the data
+ * @param  len is the number of bytes
+ * @return the CRC of all the data so far
+ * @note   Gives the same result as crc16_compute in crcBlock.c
+ * @brief  Software CRC-16
+ */
+uint16_t crcSoft_crc16(uint16_t crc, const void *buf, uint32_t len);
+
+#endif
@@ -0,0 +1,109 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        kvFlash.c
+// Function:    Flash access of kvStore.c with the driverlib flash controller calls
+
+// The store is in bank 1 and the program runs from bank 0, so the
+// flash stays readable while a sector is programmed or erased.  The ROM
+// (MAP_) flash calls verify what they wrote.  They also disable
+// interrupts while they run: a record takes well under a millisecond,
+// but a sector erase stops the system for several milliseconds.
+
+#include <stdint.h>
+#include <string.h>
+#include "msp.h"
+#include "driverlib.h"
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "kvStore.h"
+#include "kvFlash.h"
+
+static SemaphoreHandle_t xKvMutex;
+
+// Lift the write protection of the sector that holds addr, or put it back
+static void kvFlash_protect(uint32_t addr, int protect){
+    uint32_t sector, bank;
+    MAP_FlashCtl_getMemoryInfo(addr, &sector, &bank);
+    if(protect){
+        MAP_FlashCtl_protectSector(bank ? FLASH_MAIN_MEMORY_SPACE_BANK1 : FLASH_MAIN_MEMORY_SPACE_BANK0,
+                1u << sector);
+    }else{
+        MAP_FlashCtl_unprotectSector(bank ? FLASH_MAIN_MEMORY_SPACE_BANK1 : FLASH_MAIN_MEMORY_SPACE_BANK0,
+                1u << sector);
+    }
+}
+
+void kvFlash_init(void){
+    xKvMutex = xSemaphoreCreateMutex();
+    configASSERT(xKvMutex);
+}
+
+void kvFlash_read(uint32_t offset, void *buf, uint32_t len){
+    memcpy(buf, (const void *)(KV_FLASH_BASE + offset), len);
+}
+
+int kvFlash_program(uint32_t offset, const void *data, uint32_t len){
+    uint32_t addr = KV_FLASH_BASE + offset;
+    bool ok;
+    kvFlash_protect(addr, 0);
+    ok = MAP_FlashCtl_programMemory((void *)data, (void *)addr, len);
+    kvFlash_protect(addr, 1);
+    return ok;
+}
+
+int kvFlash_erase(uint32_t offset){
+    uint32_t addr = KV_FLASH_BASE + offset;
+    bool ok;
+    kvFlash_protect(addr, 0);
+    ok = MAP_FlashCtl_eraseSector(addr);
+    kvFlash_protect(addr, 1);
+    return ok;
+}
+
+void kvFlash_lock(void){
+    xSemaphoreTake(xKvMutex, portMAX_DELAY);
+}
+
+void kvFlash_unlock(void){
+    xSemaphoreGive(xKvMutex);
+}
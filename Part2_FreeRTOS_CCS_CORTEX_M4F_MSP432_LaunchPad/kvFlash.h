@@ -0,0 +1,107 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        kvFlash.h
+// Function:    Flash access used by kvStore.c
+
+#ifndef KVFLASH_H_
+#define KVFLASH_H_
+
+#include <stdint.h>
+
+// kvStore.c only reaches the flash through these functions, with offsets
+// from the start of the store.  kvFlash.c implements them with driverlib
+// on the LaunchPad.  tools/host/hostFlash.c implements them over a file
+// with NOR rules (erase sets a whole sector to 0xFF, program can only
+// clear bits) and power failures, for tools/test_kv.c on a PC.
+
+/**
+ * Prepare the flash access and the lock
+ *
+ * @param  none
+ * @return none
+ * @brief  Initialize the flash port
+ */
+void kvFlash_init(void);
+
+/**
+ * Copy bytes out of the store
+ *
+ * @param  offset is the first byte, from the start of the store
+ * @param  buf receives the bytes
+ * @param  len is the number of bytes
+ * @return none
+ * @brief  Read the store
+ */
+void kvFlash_read(uint32_t offset, void *buf, uint32_t len);
+
+/**
+ * Program bytes into erased flash
+ *
+ * @param  offset is the first byte, from the start of the store
+ * @param  data is the data
+ * @param  len is the number of bytes
+ * @return 1 if the flash now holds data, 0 if programming failed
+ * @brief  Program the store
+ */
+int kvFlash_program(uint32_t offset, const void *data, uint32_t len);
+
+/**
+ * Erase one sector of the store
+ *
+ * @param  offset is the start of the sector, from the start of the store
+ * @return 1 if the sector is erased, 0 if erasing failed
+ * @brief  Erase a store sector
+ */
+int kvFlash_erase(uint32_t offset);
+
+/**
+ * Take and give back the store, so one task uses it at a time
+ *
+ * @param  none
+ * @return none
+ * @brief  Store lock
+ */
+void kvFlash_lock(void);
+void kvFlash_unlock(void);
+
+#endif
@@ -0,0 +1,378 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        kvStore.c
+// Function:    Key/value store for calibration data, a log of records in flash
+
+// Every kv_set or kv_delete appends a record to the head sector, the
+// newest record of a key wins.  A sector starts with a header holding a
+// sequence number, so at boot the sectors are replayed oldest first into
+// a hash index in RAM that maps each key to its newest record.
+//
+// The sectors are used in turn, which spreads the erases over all of
+// them.  One sector is always kept erased.  When the head moves into it,
+// the records of the oldest sector that are still live are copied to
+// the new head and the oldest sector is erased.  Every live record fits
+// in one sector, so the copy always fits.
+//
+// Reset safety:
+//   - a record counts only if its CRC-32 matches, a record cut short by
+//     a reset is skipped and never written over
+//   - a sector is marked retired before it is erased, so a sector that
+//     was partly erased is never replayed
+//   - kv_init finishes a compaction that was cut short
+// Each 16-byte flash word is programmed once between erases.
+
+#include <stdint.h>
+#include <string.h>
+#include "crcSoft.h"
+#include "kvFlash.h"
+#include "kvStore.h"
+
+#define KV_MAGIC            0x4B565331      // "KVS1"
+#define KV_HEADER_SIZE      32              // sector header, two flash words
+#define KV_RETIRE_OFFSET    16              // cleared before the sector is erased
+#define KV_ALIGN            16              // one flash word
+#define KV_REC_HEADER       8
+#define KV_REC_SIZE(len)    ((KV_REC_HEADER + (len) + KV_ALIGN - 1) & ~(KV_ALIGN - 1))
+#define KV_INDEX_BITS       7
+#define KV_INDEX_SLOTS      (1 << KV_INDEX_BITS)
+#define KV_EMPTY            0xFFFF
+#define KV_ERASED           0xFFFFFFFF
+
+// Compile time checks: all live records plus one more fit in a sector,
+// and the index is at most half full
+typedef char kv_fits_t[(((KV_MAX_KEYS + 1)*KV_REC_SIZE(KV_MAX_VALUE) <=
+        KV_SECTOR_SIZE - KV_HEADER_SIZE) && (KV_INDEX_SLOTS >= 2*KV_MAX_KEYS) &&
+        (KV_SECTORS >= 2)) ? 1 : -1];
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;                   // larger is newer, never 0
+    uint32_t seqInv;                // ~seq
+    uint32_t reserved;
+    uint32_t retired;               // second flash word, 0 once retired
+} kvSector_t;
+
+typedef struct {
+    uint16_t key;
+    uint16_t len;                   // 0 deletes the key
+    uint32_t crc;                   // CRC-32 of key, len and the value
+} kvRecord_t;
+
+// Hash index, linear probing, where is the record offset / KV_ALIGN
+static struct {
+    uint16_t key;
+    uint16_t where;
+} xIndex[KV_INDEX_SLOTS];
+static uint32_t ulKeys;
+
+static uint32_t ulSeq[KV_SECTORS];  // 0 while the sector is erased
+static uint32_t ulHead;             // sector the records go to
+static uint32_t ulFree;             // next free offset in the head sector
+
+static int kv_append(uint16_t key, const void *data, uint32_t len);
+
+static uint32_t kv_hash(uint16_t key){
+    return ((uint32_t)key*2654435761u) >> (32 - KV_INDEX_BITS);
+}
+
+// Index slot of key, -1 if it is not in the store
+static int kv_find(uint16_t key){
+    uint32_t i = kv_hash(key);
+    while(xIndex[i].key != KV_EMPTY){
+        if(xIndex[i].key == key) return i;
+        i = (i + 1) & (KV_INDEX_SLOTS - 1);
+    }
+    return -1;
+}
+
+static void kv_insert(uint16_t key, uint32_t offset){
+    uint32_t i = kv_hash(key);
+    while((xIndex[i].key != KV_EMPTY) && (xIndex[i].key != key)){
+        i = (i + 1) & (KV_INDEX_SLOTS - 1);
+    }
+    if(xIndex[i].key == KV_EMPTY){
+        xIndex[i].key = key;
+        ulKeys++;
+    }
+    xIndex[i].where = offset/KV_ALIGN;
+}
+
+// Remove key and move later entries of the probe chain back into the gap
+static void kv_remove(uint16_t key){
+    int found = kv_find(key);
+    uint32_t i, j, h;
+    if(found < 0) return;
+    i = j = found;
+    for(;;){
+        j = (j + 1) & (KV_INDEX_SLOTS - 1);
+        if(xIndex[j].key == KV_EMPTY) break;
+        h = kv_hash(xIndex[j].key);
+        if((i <= j) ? ((i < h) && (h <= j)) : ((i < h) || (h <= j))){
+            continue;                       // already between its home and the gap
+        }
+        xIndex[i] = xIndex[j];
+        i = j;
+    }
+    xIndex[i].key = KV_EMPTY;
+    ulKeys--;
+}
+
+// Read the record at offset, 1 if it is complete and its CRC matches
+static int kv_record(uint32_t offset, kvRecord_t *rec, uint8_t *data){
+    kvFlash_read(offset, rec, KV_REC_HEADER);
+    if((rec->key == KV_EMPTY) || (rec->len > KV_MAX_VALUE) ||
+       ((offset % KV_SECTOR_SIZE) + KV_REC_SIZE(rec->len) > KV_SECTOR_SIZE)){
+        return 0;
+    }
+    kvFlash_read(offset + KV_REC_HEADER, data, rec->len);
+    return crcSoft_crc32(crcSoft_crc32(0, rec, 4), data, rec->len) == rec->crc;
+}
+
+// 1 if the flash word at offset is erased
+static int kv_blank(uint32_t offset){
+    uint32_t w[4];
+    kvFlash_read(offset, w, KV_ALIGN);
+    return (w[0] & w[1] & w[2] & w[3]) == KV_ERASED;
+}
+
+// Offset in sector s after the last flash word that is not erased
+static uint32_t kv_end(uint32_t s){
+    uint32_t off = KV_SECTOR_SIZE;
+    while((off > KV_HEADER_SIZE) && kv_blank(s*KV_SECTOR_SIZE + off - KV_ALIGN)){
+        off -= KV_ALIGN;
+    }
+    return off;
+}
+
+// Sequence number of sector s, 0 if it is not in use
+static uint32_t kv_sector(uint32_t s){
+    kvSector_t h;
+    kvFlash_read(s*KV_SECTOR_SIZE, &h, sizeof(h));
+    if((h.magic != KV_MAGIC) || (h.seq != ~h.seqInv) || (h.seq == 0) ||
+       (h.seq == KV_ERASED) || (h.retired != KV_ERASED)){
+        return 0;
+    }
+    return h.seq;
+}
+
+// Apply the records of sector s to the index
+static void kv_replay(uint32_t s, uint32_t end){
+    kvRecord_t rec;
+    uint8_t data[KV_MAX_VALUE];
+    uint32_t off = KV_HEADER_SIZE;
+    while(off < end){
+        if(kv_record(s*KV_SECTOR_SIZE + off, &rec, data) == 0){
+            off += KV_ALIGN;                // erased gap, or a record cut short
+            continue;
+        }
+        if(rec.len){
+            kv_insert(rec.key, s*KV_SECTOR_SIZE + off);
+        }else{
+            kv_remove(rec.key);
+        }
+        off += KV_REC_SIZE(rec.len);
+    }
+}
+
+// Start a new head sector, s is erased
+static int kv_open(uint32_t s, uint32_t seq){
+    kvSector_t h = { KV_MAGIC, seq, ~seq, KV_ERASED, KV_ERASED };
+    if(kvFlash_program(s*KV_SECTOR_SIZE, &h, KV_ALIGN) == 0){
+        return 0;
+    }
+    ulSeq[s] = seq;
+    ulHead = s;
+    ulFree = KV_HEADER_SIZE;
+    return 1;
+}
+
+// Retire sector s, then erase it
+static int kv_release(uint32_t s){
+    uint32_t zero[4] = { 0, 0, 0, 0 };
+    kvFlash_program(s*KV_SECTOR_SIZE + KV_RETIRE_OFFSET, zero, KV_ALIGN);
+    ulSeq[s] = 0;
+    return kvFlash_erase(s*KV_SECTOR_SIZE);
+}
+
+// If no sector is left erased, copy the live records of the oldest
+// sector to the head and erase it
+static int kv_compact(void){
+    kvRecord_t rec;
+    uint8_t data[KV_MAX_VALUE];
+    uint32_t s, oldest = ulHead, off, end;
+    int i;
+    for(s = 0; s < KV_SECTORS; s++){
+        if(ulSeq[s] == 0) return 1;
+        if(ulSeq[s] < ulSeq[oldest]) oldest = s;
+    }
+    end = kv_end(oldest);
+    for(off = KV_HEADER_SIZE; off < end; ){
+        if(kv_record(oldest*KV_SECTOR_SIZE + off, &rec, data) == 0){
+            off += KV_ALIGN;
+            continue;
+        }
+        i = kv_find(rec.key);
+        if(rec.len && (i >= 0) && (xIndex[i].where == (oldest*KV_SECTOR_SIZE + off)/KV_ALIGN)){
+            if(kv_append(rec.key, data, rec.len) == 0) return 0;
+        }
+        off += KV_REC_SIZE(rec.len);        // older values and deletes are dropped
+    }
+    return kv_release(oldest);
+}
+
+// The head is full, move to the next erased sector
+static int kv_advance(void){
+    uint32_t i, s;
+    for(i = 1; i < KV_SECTORS; i++){
+        s = (ulHead + i) % KV_SECTORS;
+        if(ulSeq[s] == 0){
+            return kv_open(s, ulSeq[ulHead] + 1) && kv_compact();
+        }
+    }
+    return 0;
+}
+
+static int kv_append(uint16_t key, const void *data, uint32_t len){
+    uint32_t buf[KV_REC_SIZE(KV_MAX_VALUE)/4];
+    kvRecord_t *rec = (kvRecord_t *)buf;
+    uint32_t offset;
+    if(ulFree + KV_REC_SIZE(len) > KV_SECTOR_SIZE){
+        if(kv_advance() == 0) return 0;
+    }
+    rec->key = key;
+    rec->len = len;
+    memcpy(&buf[KV_REC_HEADER/4], data, len);
+    rec->crc = crcSoft_crc32(crcSoft_crc32(0, rec, 4), data, len);
+    offset = ulHead*KV_SECTOR_SIZE + ulFree;
+    ulFree += KV_REC_SIZE(len);             // used even if programming fails
+    if(kvFlash_program(offset, buf, KV_REC_HEADER + len) == 0){
+        return 0;
+    }
+    if(len){
+        kv_insert(key, offset);
+    }else{
+        kv_remove(key);
+    }
+    return 1;
+}
+
+int kv_init(void){
+    uint32_t s, seq, last = 0, next, end;
+    kvFlash_init();
+    memset(xIndex, 0xFF, sizeof(xIndex));
+    ulKeys = 0;
+    for(s = 0; s < KV_SECTORS; s++){
+        ulSeq[s] = kv_sector(s);
+        if((ulSeq[s] == 0) && ((kv_end(s) > KV_HEADER_SIZE) || !kv_blank(s*KV_SECTOR_SIZE) ||
+           !kv_blank(s*KV_SECTOR_SIZE + KV_RETIRE_OFFSET))){
+            if(kvFlash_erase(s*KV_SECTOR_SIZE) == 0) return 0;
+        }
+    }
+    // Replay oldest first, the newest sector becomes the head
+    for(;;){
+        next = KV_SECTORS;
+        for(s = 0; s < KV_SECTORS; s++){
+            seq = ulSeq[s];
+            if((seq > last) && ((next == KV_SECTORS) || (seq < ulSeq[next]))){
+                next = s;
+            }
+        }
+        if(next == KV_SECTORS) break;
+        end = kv_end(next);
+        kv_replay(next, end);
+        ulHead = next;
+        ulFree = end;
+        last = ulSeq[next];
+    }
+    if(last == 0){
+        return kv_open(0, 1);               // new store
+    }
+    return kv_compact();                    // finish one cut short by a reset
+}
+
+uint32_t kv_get(uint16_t key, void *buf, uint32_t size){
+    kvRecord_t rec;
+    uint8_t data[KV_MAX_VALUE];
+    uint32_t len = 0;
+    int i;
+    kvFlash_lock();
+    i = kv_find(key);
+    if((i >= 0) && kv_record(xIndex[i].where*KV_ALIGN, &rec, data)){
+        len = rec.len;
+        memcpy(buf, data, (len < size) ? len : size);
+    }
+    kvFlash_unlock();
+    return len;
+}
+
+int kv_set(uint16_t key, const void *data, uint32_t len){
+    kvRecord_t rec;
+    uint8_t old[KV_MAX_VALUE];
+    int i, ok;
+    if((key == KV_EMPTY) || (len == 0) || (len > KV_MAX_VALUE)){
+        return 0;
+    }
+    kvFlash_lock();
+    i = kv_find(key);
+    if(i < 0){
+        ok = (ulKeys < KV_MAX_KEYS) && kv_append(key, data, len);
+    }else if(kv_record(xIndex[i].where*KV_ALIGN, &rec, old) && (rec.len == len) &&
+             (memcmp(old, data, len) == 0)){
+        ok = 1;                             // no change, save the flash
+    }else{
+        ok = kv_append(key, data, len);
+    }
+    kvFlash_unlock();
+    return ok;
+}
+
+int kv_delete(uint16_t key){
+    int ok = 1;
+    kvFlash_lock();
+    if(kv_find(key) >= 0){
+        ok = kv_append(key, "", 0);
+    }
+    kvFlash_unlock();
+    return ok;
+}
@@ -0,0 +1,110 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        kvStore.h
+// Function:    header file of kvStore.c
+
+#ifndef KVSTORE_H_
+#define KVSTORE_H_
+
+#include <stdint.h>
+
+// The store takes KV_SECTORS sectors of bank 1 below the image trailer,
+// MAIN in msp432p401r.cmd ends at KV_FLASH_BASE
+#define KV_FLASH_BASE       0x0003D000
+#define KV_SECTORS          2           // at least 2, one is always kept erased
+#define KV_SECTOR_SIZE      4096
+
+#define KV_MAX_KEYS         48          // keys 0 to 0xFFFE
+#define KV_MAX_VALUE        56          // bytes per value
+
+/**
+ * Find the newest record of every key and build the index in RAM
+ *
+ * @param  none
+ * @return 1 if the store is ready, 0 if the flash could not be
+ *         programmed or erased
+ * @note   Formats the sectors the first time.  Finishes a compaction or
+ *         an erase that a reset interrupted.  Call once before
+ *         vTaskStartScheduler
+ * @brief  Initialize the key/value store
+ */
+int kv_init(void);
+
+/**
+ * Read the value of a key
+ *
+ * @param  key is the key
+ * @param  buf receives the value
+ * @param  size is the size of buf, a longer value is cut short
+ * @return the length of the value, 0 if the key is not in the store
+ * @note   One index lookup and a copy from flash
+ * @brief  Read a value
+ */
+uint32_t kv_get(uint16_t key, void *buf, uint32_t size);
+
+/**
+ * Store the value of a key
+ *
+ * @param  key is the key, 0 to 0xFFFE
+ * @param  data is the value
+ * @param  len is its length, 1 to KV_MAX_VALUE
+ * @return 1 if the value is stored, 0 if not (bad length, KV_MAX_KEYS
+ *         keys already stored, or a flash error)
+ * @note   The new record only counts once it is completely programmed,
+ *         after a reset the key has either the old or the new value.
+ *         Writing the value it already has does not touch the flash.
+ *         Blocks while a sector is erased, call from a task
+ * @brief  Write a value
+ */
+int kv_set(uint16_t key, const void *data, uint32_t len);
+
+/**
+ * Remove a key from the store
+ *
+ * @param  key is the key
+ * @return 1 if the key is gone, 0 on a flash error
+ * @brief  Delete a value
+ */
+int kv_delete(uint16_t key);
+
+#endif
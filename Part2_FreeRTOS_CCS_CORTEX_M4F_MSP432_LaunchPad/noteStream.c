@@ -0,0 +1,101 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        noteStream.c
+// Function:    Decoder of the compact 2 bytes per note song format
+
+#include <stdint.h>
+#include "noteStream.h"
+
+// Octave 7 (C7 to B7) in Hz, lower octaves are shifted right
+static const uint16_t usOctave7[12] = {
+    2093, 2217, 2349, 2489, 2637, 2794, 2960, 3136, 3322, 3520, 3729, 3951
+};
+
+// Length of each duration code in sixteenth notes
+static const uint8_t ucSixteenths[8] = { 16, 8, 4, 2, 1, 12, 6, 3 };
+
+void noteStream_init(noteStream_t *d, const uint16_t *song){
+    d->song = song;
+    d->pos = 0;
+    d->bpm = SONG_DEFAULT_BPM;
+    d->repeatLeft = 0;
+}
+
+int noteStream_next(noteStream_t *d, tone_note_t *note){
+    uint16_t token, kind, dur;
+    for(;;){
+        token = d->song[d->pos];
+        kind = token>>12;
+        if(kind == SONG_KIND_END){
+            return 0;                   // stay on the end token
+        }
+        d->pos++;
+        if(kind == SONG_KIND_TEMPO){
+            d->bpm = token&0x0FFF;
+            if(d->bpm == 0) d->bpm = SONG_DEFAULT_BPM;
+            if(d->bpm < SONG_MIN_BPM) d->bpm = SONG_MIN_BPM;
+            continue;
+        }
+        if(kind == SONG_KIND_REPEAT){
+            if(d->repeatLeft && (d->repeatEnd == d->pos - 1)){
+                d->repeatLeft--;        // the active repeat came round again
+            }else{
+                d->repeatEnd = d->pos - 1;
+                d->repeatLeft = (token>>6)&0x3F;
+            }
+            if(d->repeatLeft){
+                d->pos = d->pos - 1 - (token&0x3F);
+            }
+            continue;
+        }
+        // a note or a rest, 60000ms/bpm per quarter is 15000/bpm per sixteenth
+        dur = ucSixteenths[(token>>6)&7];
+        note->ms = (uint16_t)((15000UL*dur)/d->bpm);
+        if(kind == SONG_KIND_REST){
+            note->freq = 0;
+        }else{
+            note->freq = usOctave7[kind]>>(7 - ((token>>9)&7));
+        }
+        return 1;
+    }
+}
@@ -0,0 +1,134 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        noteStream.h
+// Function:    header file of noteStream.c
+
+#ifndef NOTESTREAM_H_
+#define NOTESTREAM_H_
+
+#include <stdint.h>
+#include "tone.h"
+
+// A song is an array of 16-bit tokens in flash, one per note, ending
+// with SONG_END.  Write it with the macros below or compile it from a
+// text score with tools/song_compile.py
+//   bits 15-12  kind: 0-11 note (C to B), 12 rest, 13 tempo, 14 repeat, 15 end
+//   note        bits 11-9 octave (0-7), bits 8-6 duration code
+//   rest        bits 8-6 duration code
+//   tempo       bits 11-0 quarter notes per minute
+//   repeat      bits 11-6 extra times (1-63), bits 5-0 tokens to go back (1-63)
+// Repeats cannot be nested.
+
+// Notes
+#define NOTE_C      0
+#define NOTE_CS     1
+#define NOTE_D      2
+#define NOTE_DS     3
+#define NOTE_E      4
+#define NOTE_F      5
+#define NOTE_FS     6
+#define NOTE_G      7
+#define NOTE_GS     8
+#define NOTE_A      9
+#define NOTE_AS     10
+#define NOTE_B      11
+
+// Duration codes
+#define DUR_WHOLE   0
+#define DUR_HALF    1
+#define DUR_QUARTER 2
+#define DUR_EIGHTH  3
+#define DUR_SIXTEENTH 4
+#define DUR_DOTTED_HALF 5
+#define DUR_DOTTED_QUARTER 6
+#define DUR_DOTTED_EIGHTH 7
+
+#define SONG_KIND_REST      12
+#define SONG_KIND_TEMPO     13
+#define SONG_KIND_REPEAT    14
+#define SONG_KIND_END       15
+
+#define SONG_NOTE(note,octave,dur)  ((uint16_t)(((note)<<12)|(((octave)&7)<<9)|(((dur)&7)<<6)))
+#define SONG_REST(dur)              ((uint16_t)((SONG_KIND_REST<<12)|(((dur)&7)<<6)))
+#define SONG_TEMPO(bpm)             ((uint16_t)((SONG_KIND_TEMPO<<12)|((bpm)&0x0FFF)))
+#define SONG_REPEAT(times,back)     ((uint16_t)((SONG_KIND_REPEAT<<12)|(((times)&0x3F)<<6)|((back)&0x3F)))
+#define SONG_END                    ((uint16_t)(SONG_KIND_END<<12))
+
+// Tempo until the first SONG_TEMPO
+#define SONG_DEFAULT_BPM    120
+// Slowest tempo, a whole note at 4 bpm (60000ms) still fits the uint16_t
+// ms, at 3 bpm it would be 80000ms
+#define SONG_MIN_BPM        4
+
+// Decoder state, one per song being played
+typedef struct {
+    const uint16_t *song;
+    uint16_t pos;           // next token
+    uint16_t bpm;
+    uint16_t repeatEnd;     // position of the active repeat token
+    uint8_t  repeatLeft;    // times still to go back, 0 if none active
+} noteStream_t;
+
+/**
+ * Start decoding a song
+ *
+ * @param  d is the decoder state
+ * @param  song is the token array, it must stay valid while decoding
+ * @return none
+ * @brief  Initialize a note stream
+ */
+void noteStream_init(noteStream_t *d, const uint16_t *song);
+
+/**
+ * Decode the next note or rest
+ *
+ * @param  d is the decoder state
+ * @param  note is filled with the frequency (0 for a rest) and duration
+ * @return 1 if a note was produced, 0 at the end of the song
+ * @note   Only decodes as far as the next note, so it costs a few
+ *         tens of cycles per call
+ * @brief  Next note of a note stream
+ */
+int noteStream_next(noteStream_t *d, tone_note_t *note);
+
+#endif
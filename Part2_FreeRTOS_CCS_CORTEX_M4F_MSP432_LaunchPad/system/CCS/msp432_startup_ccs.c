@@ -51,6 +51,9 @@ extern void _c_int00(void);
 /* External declaration for system initialization function                  */
 extern void SystemInit(void);
 
+/* External declaration for the application image check (bootCheck.c)      */
+extern void bootCheck_image(void);
+
 /* Linker variable that marks the top of the stack. */
 extern unsigned long __STACK_END;
 
@@ -65,6 +68,9 @@ demo application. */
 extern void vUART_Handler( void );
 extern void vT32_0_Handler( void );
 extern void vT32_1_Handler( void );
+extern void vWave_Handler( void );
+extern void vSerialTxDMA_Handler( void );
+extern void vAES_Handler( void );
 
 /* Intrrupt vector table.  Note that the proper constructs must be placed on this to  */
 /* ensure that it ends up at physical address 0x0000.0000 or at the start of          */
@@ -118,12 +124,12 @@ void (* const interruptVectors[])(void) =
 	vT32_0_Handler,                         /* T32_INT1 ISR              */
 	vT32_1_Handler,                         /* T32_INT2 ISR              */
     defaultISR,                             /* T32_INTC ISR              */
-    defaultISR,                             /* AES ISR                   */
+    vAES_Handler,                           /* AES ISR                   */
     defaultISR,                             /* RTC ISR                   */
     defaultISR,                             /* DMA_ERR ISR               */
     defaultISR,                             /* DMA_INT3 ISR              */
-    defaultISR,                             /* DMA_INT2 ISR              */
-    defaultISR,                             /* DMA_INT1 ISR              */
+    vWave_Handler,                          /* DMA_INT2 ISR              */
+    vSerialTxDMA_Handler,                   /* DMA_INT1 ISR              */
     defaultISR,                             /* DMA_INT0 ISR              */
 	defaultISR,                             /* PORT1 ISR                 */
     defaultISR,                             /* PORT2 ISR                 */
@@ -170,6 +176,11 @@ void resetISR(void)
 
     /* Jump to the CCS C Initialization Routine. */
 	MAP_WDT_A_holdTimer();
+
+    /* Check the image in flash before any of it runs, this does not return */
+    /* if the image does not match its trailer.                              */
+    bootCheck_image();
+
     __asm("    .global _c_int00\n"
           "    b.w     _c_int00");
 }
@@ -41,7 +41,9 @@
 
 MEMORY
 {
-    MAIN       (RX) : origin = 0x00000000, length = 0x00040000
+    MAIN       (RX) : origin = 0x00000000, length = 0x0003D000
+    KVSTORE    (R)  : origin = 0x0003D000, length = 0x00002000
+    TRAILER    (R)  : origin = 0x0003F000, length = 0x00001000
     INFO       (RX) : origin = 0x00200000, length = 0x00004000
     SRAM_CODE  (RWX): origin = 0x01000000, length = 0x00010000
     SRAM_DATA  (RW) : origin = 0x20000000, length = 0x00010000
@@ -70,11 +72,16 @@ SECTIONS
     .cinit  :   > MAIN
     .pinit  :   > MAIN
 
+    /* Image CRC trailer, last sector of flash, see bootCheck.h */
+    .imageTrailer : > TRAILER
+    /* KVSTORE holds no sections, kvStore.c writes it at run time */
+
     .flashMailbox : > 0x00200000
 
     .vtable :   > 0x20000000
     .data   :   > SRAM_DATA
     .bss    :   > SRAM_DATA
+    .TI.noinit : > SRAM_DATA
     .sysmem :   > SRAM_DATA
     .stack  :   > SRAM_DATA (HIGH)
 }
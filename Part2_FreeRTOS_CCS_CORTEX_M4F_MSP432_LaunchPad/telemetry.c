@@ -0,0 +1,204 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        telemetry.c
+// Function:    Binary telemetry frames over the UART with COBS framing and the CRC32 peripheral
+
+// Each channel has a fixed payload and its own rate.  Every TELEM_TICK_MS
+// the telemetry task builds a frame for each channel that is due, appends
+// the CRC from the CRC32 module (crcBlock.c), COBS encodes it and queues
+// it with xSerialWrite.  A pose frame is 22 bytes on the wire (20 bytes of
+// frame, one COBS code byte and the delimiter), a few times less than the
+// same values printed as text, and no formatting is done.
+
+#include <stdint.h>
+#include <string.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "telemetry.h"
+#include "bumpSwitch.h"
+#include "serialExt.h"
+#include "crcBlock.h"
+
+// Header, payload and CRC
+#define TELEM_FRAME_WORDS   (1 + TELEM_MAX_PAYLOAD/4 + 1)
+// COBS adds one byte per 254 and the delimiter
+#define TELEM_COBS_MAX      (4*TELEM_FRAME_WORDS + 2)
+
+static const uint8_t ucSize[TELEM_CHANNELS] = {
+    sizeof(telem_pose_t), sizeof(telem_motor_t),
+    sizeof(telem_bump_t), sizeof(telem_stats_t)
+};
+
+static telem_source_t pxSource[TELEM_CHANNELS];
+static uint16_t usPeriod[TELEM_CHANNELS];       // in ticks of TELEM_TICK_MS, 0 off
+static uint16_t usCount[TELEM_CHANNELS];        // ticks until the channel is due
+static uint16_t usSeq;
+static volatile uint32_t ulDropped;
+static uint8_t ucCut;                           // 1 if a frame went out without its delimiter
+
+static uint32_t ulFrame[TELEM_FRAME_WORDS];
+static uint8_t ucWire[TELEM_COBS_MAX];
+
+// Built in sources
+static void telemetry_bump(void *payload){
+    telem_bump_t *p = (telem_bump_t *)payload;
+    p->bump = Bump_Read_Input();
+}
+
+static void telemetry_stats(void *payload){
+    telem_stats_t *p = (telem_stats_t *)payload;
+    p->uptime = xTaskGetTickCount()*portTICK_PERIOD_MS;
+    p->freeHeap = xPortGetFreeHeapSize();
+    p->tasks = uxTaskGetNumberOfTasks();
+    p->dropped = (uint16_t)ulDropped;
+}
+
+uint16_t telemetry_cobs(const uint8_t *in, uint16_t n, uint8_t *out){
+    uint16_t code = 0;      // index of the current code byte
+    uint16_t o = 1;
+    uint16_t i;
+    for(i = 0; i < n; i++){
+        if(in[i] == 0){
+            out[code] = (uint8_t)(o - code);
+            code = o++;
+        }else{
+            out[o++] = in[i];
+            if((o - code) == 0xFF){      // 254 data bytes, start a new block
+                out[code] = 0xFF;
+                code = o++;
+            }
+        }
+    }
+    out[code] = (uint8_t)(o - code);
+    out[o++] = 0x00;
+    return o;
+}
+
+// Build, encode and queue one frame
+static void telemetry_send(uint8_t channel){
+    uint8_t len = ucSize[channel];
+    uint16_t words = 1 + len/4;
+    uint16_t n;
+    static const uint8_t ucDelimiter = 0x00;
+
+    memset(&ulFrame[1], 0, len);
+    pxSource[channel](&ulFrame[1]);
+    ulFrame[0] = usSeq | ((uint32_t)channel << 16) | ((uint32_t)len << 24);
+    ulFrame[words] = crc32_compute(ulFrame, 4*words);
+    usSeq++;
+
+    n = telemetry_cobs((const uint8_t *)ulFrame, 4*(words + 1), ucWire);
+    // A frame only goes in whole.  If the ring has no room for it after
+    // a tick the frame is dropped, the host sees a gap in the sequence.
+    if(xSerialTxSpace() < n + ucCut){
+        xSerialTxFlush(pdMS_TO_TICKS(TELEM_TICK_MS));
+    }
+    if(ucCut && (xSerialWrite(&ucDelimiter, 1) == 1)){
+        ucCut = 0;
+    }
+    if(ucCut || (xSerialTxSpace() < n)){
+        ulDropped++;
+        return;
+    }
+    // Another task writing in between can still leave room for only part
+    // of it.  The piece is then ended with a delimiter, now or before the
+    // next frame, so the host drops this frame alone on the CRC.
+    if(xSerialWrite(ucWire, n) < n){
+        ulDropped++;
+        ucCut = (xSerialWrite(&ucDelimiter, 1) == 0);
+    }
+}
+
+static void telemetry_task(void *pvParameters){
+    TickType_t xLast = xTaskGetTickCount();
+    uint8_t i;
+    (void)pvParameters;
+    for(;;){
+        vTaskDelayUntil(&xLast, pdMS_TO_TICKS(TELEM_TICK_MS));
+        for(i = 0; i < TELEM_CHANNELS; i++){
+            if(usPeriod[i] == 0){
+                continue;
+            }
+            if(--usCount[i] == 0){
+                usCount[i] = usPeriod[i];
+                if(pxSource[i]){
+                    telemetry_send(i);
+                }else{
+                    ulDropped++;
+                }
+            }
+        }
+    }
+}
+
+void telemetry_source(uint8_t channel, telem_source_t source){
+    if(channel < TELEM_CHANNELS){
+        pxSource[channel] = source;
+    }
+}
+
+void telemetry_rate(uint8_t channel, uint16_t ms){
+    uint16_t ticks = (ms + TELEM_TICK_MS/2)/TELEM_TICK_MS;
+    if(channel >= TELEM_CHANNELS){
+        return;
+    }
+    if((ms != 0) && (ticks == 0)){
+        ticks = 1;
+    }
+    taskENTER_CRITICAL();
+    usPeriod[channel] = ticks;
+    usCount[channel] = ticks;
+    taskEXIT_CRITICAL();
+}
+
+uint32_t telemetry_dropped(void){
+    return ulDropped;
+}
+
+void telemetry_init(UBaseType_t priority){
+    telemetry_source(TELEM_BUMP, telemetry_bump);
+    telemetry_source(TELEM_STATS, telemetry_stats);
+    telemetry_rate(TELEM_BUMP, 100);
+    telemetry_rate(TELEM_STATS, 1000);
+    xTaskCreate(telemetry_task, "Telem", configMINIMAL_STACK_SIZE, NULL, priority, NULL);
+}
@@ -0,0 +1,151 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        telemetry.h
+// Function:    header file of telemetry.c
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+
+// Frame on the wire, before COBS encoding, all fields little-endian:
+//   seq (2)  channel (1)  length (1)  payload (length)  crc32 (4)
+// The CRC is the standard CRC-32 (as zlib crc32) of seq to the end of the
+// payload.  The COBS encoded frame is followed by a single 0x00.
+// tools/telemetry.py decodes the stream on the host.
+
+// Channels, and the fixed payload of each.  Every payload is a whole
+// number of 32-bit words so the frame can be built in a word buffer.
+#define TELEM_POSE      0       // telem_pose_t
+#define TELEM_MOTOR     1       // telem_motor_t
+#define TELEM_BUMP      2       // telem_bump_t
+#define TELEM_STATS     3       // telem_stats_t
+#define TELEM_CHANNELS  4
+
+typedef struct {
+    int32_t x;                  // mm, Q16
+    int32_t y;                  // mm, Q16
+    uint16_t theta;             // 65536 counts per turn
+    uint16_t reserved;
+} telem_pose_t;
+
+typedef struct {
+    int16_t left;               // signed duty cycle, negative is backward
+    int16_t right;
+} telem_motor_t;
+
+typedef struct {
+    uint8_t bump;               // one bit per switch, 1 pressed
+    uint8_t reserved[3];
+} telem_bump_t;
+
+typedef struct {
+    uint32_t uptime;            // ms since the scheduler started
+    uint32_t freeHeap;          // bytes
+    uint16_t tasks;             // number of tasks
+    uint16_t dropped;           // frames not sent, see telemetry_dropped
+} telem_stats_t;
+
+#define TELEM_MAX_PAYLOAD   12
+// Time between checks of the channel rates
+#define TELEM_TICK_MS       10
+
+// Fills the payload of one channel, called from the telemetry task
+typedef void (*telem_source_t)(void *payload);
+
+/**
+ * Create the telemetry task
+ *
+ * @param  priority is the FreeRTOS priority of the task
+ * @return none
+ * @note   xSerialPortInitMinimal must have been called.  The stats
+ *         channel is sent once a second, the bump channel 10 times
+ *         a second, the others are off until given a source
+ * @brief  Start the binary telemetry stream
+ */
+void telemetry_init(UBaseType_t priority);
+
+/**
+ * Set the function that reads the data of a channel
+ *
+ * @param  channel is TELEM_POSE to TELEM_STATS
+ * @param  source fills the payload, NULL turns the channel off
+ * @return none
+ * @brief  Connect a data source to a channel
+ */
+void telemetry_source(uint8_t channel, telem_source_t source);
+
+/**
+ * Set how often a channel is sent
+ *
+ * @param  channel is TELEM_POSE to TELEM_STATS
+ * @param  ms is the time between frames, rounded to TELEM_TICK_MS,
+ *         0 turns the channel off
+ * @return none
+ * @brief  Set the rate of a channel
+ */
+void telemetry_rate(uint8_t channel, uint16_t ms);
+
+/**
+ * Encode a buffer with Consistent Overhead Byte Stuffing
+ *
+ * @param  in is the data, any byte values
+ * @param  n is the number of bytes in
+ * @param  out receives n + n/254 + 2 bytes at most
+ * @return number of bytes written to out, including the 0x00 delimiter
+ * @brief  COBS encoder
+ */
+uint16_t telemetry_cobs(const uint8_t *in, uint16_t n, uint8_t *out);
+
+/**
+ * Number of frames that were due but not sent because the channel
+ * source was missing or the UART could not keep up
+ *
+ * @param  none
+ * @return frames dropped since start up
+ * @brief  Overflow counter
+ */
+uint32_t telemetry_dropped(void);
+
+#endif
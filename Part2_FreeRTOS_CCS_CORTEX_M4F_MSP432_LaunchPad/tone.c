@@ -0,0 +1,224 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Buzzer connected to P2.4/TA0.1
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        tone.c
+// Function:    Buzzer tones from Timer A0 with notes timed by a FreeRTOS software timer
+
+// Timer A0 runs in up mode and CCR1 toggles P2.4 every period, so the
+// square wave needs no CPU at all.  A one-shot software timer fires at
+// the end of every note and loads the next one, a few hundred cycles
+// per note instead of bit-banging P2.4 with delay_us.
+
+#include <stdint.h>
+#include "msp.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "tone.h"
+#include "noteStream.h"
+#include "wave.h"
+
+static TimerHandle_t xToneTimer;
+static const tone_note_t *pxSong;   // notes still to play
+static uint16_t usLeft;             // number of notes in pxSong
+static tone_note_t xBeep;           // note played by tone_beep
+static noteStream_t xStream;        // decoder of the song played by tone_play_stream
+static uint8_t ucStream;            // 1 if the notes come from xStream
+static volatile uint8_t ucGap;      // 1 while in the gap after a note
+static volatile uint8_t ucPlaying;
+
+// A new song for the timer task.  The song is only ever changed in the
+// timer task, between two calls of tone_next: the caller may have a
+// higher priority than the timer task, and stopping the timer does not
+// wait for a callback that is already running.
+typedef struct {
+    const tone_note_t *song;        // notes to play, NULL for none
+    uint16_t n;                     // number of notes in song
+    const uint16_t *stream;         // note-stream song, used instead if not NULL
+    tone_note_t beep;               // copied to xBeep if song is &xBeep
+    TaskHandle_t xCaller;
+    volatile uint8_t ucDone;
+} tone_request_t;
+
+// Start the square wave, 0 stops it
+static void tone_output(uint16_t freq){
+    uint32_t counts;
+    TIMER_A0->CTL &= ~0x0030;           // halt Timer A0
+    if(freq == 0){
+        TIMER_A0->CCTL[1] = 0x0000;     // OUT mode, output low
+        return;
+    }
+    // timer runs at SMCLK/8, the output toggles once per period
+    counts = (MAP_CS_getSMCLK()/8)/(2*(uint32_t)freq);
+    if(counts > 0x10000) counts = 0x10000;
+    if(counts < 2) counts = 2;
+    TIMER_A0->CCR[0] = counts - 1;
+    TIMER_A0->CCR[1] = 0;
+    TIMER_A0->CCTL[1] = 0x0080;         // toggle mode
+    // wave.c runs the timer at SMCLK/1, so set the whole CTL
+    TIMER_A0->CTL = 0x02C0 | 0x0014;    // SMCLK/8, reset and start in up mode
+}
+
+// Get the next note from the array or the note stream
+static int tone_fetch(tone_note_t *note){
+    if(ucStream){
+        return noteStream_next(&xStream, note);
+    }
+    if(usLeft == 0){
+        return 0;
+    }
+    *note = *pxSong;
+    pxSong++;
+    usLeft--;
+    return 1;
+}
+
+// Start the next note or the gap after one, called from the timer task
+static void tone_next(void){
+    TickType_t xTicks;
+    tone_note_t xNote;
+    if(!ucGap && (TONE_GAP_MS != 0) && ucPlaying){
+        tone_output(0);
+        ucGap = 1;
+        xTicks = pdMS_TO_TICKS(TONE_GAP_MS);
+    }else if(tone_fetch(&xNote)){
+        tone_output(xNote.freq);
+        xTicks = pdMS_TO_TICKS(xNote.ms);
+        ucGap = 0;
+        ucPlaying = 1;
+    }else{
+        tone_output(0);
+        ucPlaying = 0;
+        return;
+    }
+    if(xTicks == 0) xTicks = 1;
+    xTimerChangePeriod(xToneTimer, xTicks, 0);    // also starts the timer
+}
+
+static void prvToneCallback(TimerHandle_t xTimer){
+    (void)xTimer;
+    tone_next();
+}
+
+void tone_init(void){
+    P2->SEL0 |= 0x10;
+    P2->SEL1 &= ~0x10;                  // configure P2.4 as TA0.1
+    P2->DIR |= 0x10;                    // make P2.4 out
+    TIMER_A0->CTL = 0x02C0;             // SMCLK, divide by 8, halted
+    TIMER_A0->EX0 = 0x0000;             // input divider /1
+    TIMER_A0->CCTL[0] = 0x0000;         // no interrupts
+    TIMER_A0->CCTL[1] = 0x0000;         // output low
+    usLeft = 0;
+    ucStream = 0;
+    ucPlaying = 0;
+    xToneTimer = xTimerCreate("Tone", 1, pdFALSE, NULL, prvToneCallback);
+    configASSERT(xToneTimer);
+}
+
+// Switch to the requested song and start its first note, pended to the
+// timer task by tone_request
+static void tone_start(void *pvRequest, uint32_t ulUnused){
+    tone_request_t *pxRequest = (tone_request_t *)pvRequest;
+    (void)ulUnused;
+    wave_stop();                        // a sound may be using Timer A0
+    if(pxRequest->stream){
+        noteStream_init(&xStream, pxRequest->stream);
+        ucStream = 1;
+        usLeft = 0;
+    }else{
+        if(pxRequest->song == &xBeep){
+            xBeep = pxRequest->beep;    // xBeep may be the note playing
+        }
+        pxSong = pxRequest->song;
+        usLeft = pxRequest->n;
+        ucStream = 0;
+    }
+    ucGap = 1;                          // no gap before the first note
+    ucPlaying = 0;
+    // A note of the old song still timing out finds nothing left to play
+    // if the new one is empty, otherwise its period is restarted here
+    tone_next();
+    pxRequest->ucDone = 1;
+    xTaskNotifyGive(pxRequest->xCaller);    // the caller may return now
+}
+
+// Hand a request to the timer task and wait until it has been taken
+static void tone_request(tone_request_t *pxRequest){
+    pxRequest->xCaller = xTaskGetCurrentTaskHandle();
+    pxRequest->ucDone = 0;
+    xTimerPendFunctionCall(tone_start, pxRequest, 0, portMAX_DELAY);
+    do{
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }while(!pxRequest->ucDone);
+}
+
+void tone_play(const tone_note_t *song, uint16_t n){
+    tone_request_t xRequest = {0};
+    xRequest.song = song;
+    xRequest.n = n;
+    tone_request(&xRequest);
+}
+
+void tone_play_stream(const uint16_t *song){
+    tone_request_t xRequest = {0};
+    xRequest.stream = song;
+    tone_request(&xRequest);
+}
+
+void tone_beep(uint16_t freq, uint16_t ms){
+    tone_request_t xRequest = {0};
+    xRequest.song = &xBeep;
+    xRequest.n = 1;
+    xRequest.beep.freq = freq;
+    xRequest.beep.ms = ms;
+    tone_request(&xRequest);
+}
+
+void tone_stop(void){
+    tone_play(NULL, 0);
+}
+
+int tone_busy(void){
+    return ucPlaying;
+}
@@ -0,0 +1,130 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        tone.h
+// Function:    header file of tone.c
+
+#ifndef TONE_H_
+#define TONE_H_
+
+#include <stdint.h>
+
+// One note of a song, a frequency of 0 is a rest
+typedef struct {
+    uint16_t freq;      // Hz
+    uint16_t ms;        // duration in ms
+} tone_note_t;
+
+// Silence added after every note so repeated notes are heard separately
+#define TONE_GAP_MS     20
+
+/**
+ * Set up the buzzer on P2.4 as the Timer A0 CCR1 output and create
+ * the software timer that ends the notes
+ *
+ * @param  none
+ * @return none
+ * @note   Call before vTaskStartScheduler, replaces init_song_pwm
+ * @brief  Initialize the tone generator
+ */
+void tone_init(void);
+
+/**
+ * Play a song in the compact note-stream format in the background
+ *
+ * @param  song is an array of tokens ending with SONG_END, see noteStream.h
+ * @return none
+ * @note   Returns once the timer task has the song, stops whatever
+ *         is playing.  The notes are decoded one at a time as they
+ *         are needed.  Call from a task, as tone_play
+ * @brief  Non-blocking note-stream player
+ */
+void tone_play_stream(const uint16_t *song);
+
+/**
+ * Play one note in the background
+ *
+ * @param  freq is the frequency in Hz, 0 for silence
+ * @param  ms is the duration in ms
+ * @return none
+ * @note   Returns once the note has started, stops whatever song is
+ *         playing.  Replaces beep, which busy-waits for the whole
+ *         note.  Call from a task, as tone_play
+ * @brief  Non-blocking beep
+ */
+void tone_beep(uint16_t freq, uint16_t ms);
+
+/**
+ * Play a song in the background
+ *
+ * @param  song is an array of notes, it must stay valid while playing
+ * @param  n is the number of notes
+ * @return none
+ * @note   Returns once the timer task has the song, stops whatever
+ *         is playing.  Each note costs one software timer callback,
+ *         the timer hardware makes the square wave on its own.
+ *         Call from a task after the scheduler has started, not
+ *         from an ISR or a software timer callback
+ * @brief  Non-blocking play_song
+ */
+void tone_play(const tone_note_t *song, uint16_t n);
+
+/**
+ * Silence the buzzer and drop the rest of the song
+ *
+ * @param  none
+ * @return none
+ * @note   Call from a task, as tone_play
+ * @brief  Stop playing
+ */
+void tone_stop(void);
+
+/**
+ * Check whether a note or song is still playing
+ *
+ * @param  none
+ * @return 1 while playing, 0 when silent
+ * @brief  Tone busy flag
+ */
+int tone_busy(void);
+
+#endif
@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+# Author:      Mohd A. Zainol
+# Date:        16 Oct 2026
+# File:        aes_kat.py
+# Function:    Host model of aesStream.c and its known-answer tests
+#
+# Usage: python3 aes_kat.py          run the tests
+#        python3 aes_kat.py -c       print the vectors as C for aesStream.c
+#
+# A plain software AES-256 with CTR and CBC carried across calls the way
+# aes_crypt does it: the IV buffer is updated after every call, so a
+# message may be cut into pieces that are multiples of 16 bytes (CTR
+# allows a shorter last piece).  The vectors are the AES-256 examples of
+# NIST SP 800-38A (F.2.5, F.2.6, F.5.5, F.5.6), the same ones
+# aes_selfTest runs on the accelerator.
+
+import sys
+
+SBOX = []
+INV = [0] * 256
+
+
+def _init():
+    p = q = 1
+    sbox = [0] * 256
+    while True:
+        p = p ^ ((p << 1) & 0xFF) ^ (0x1B if p & 0x80 else 0)
+        q ^= q << 1
+        q ^= q << 2
+        q ^= q << 4
+        q &= 0xFF
+        if q & 0x80:
+            q ^= 0x09
+        x = q ^ (q << 1 | q >> 7) ^ (q << 2 | q >> 6) ^ (q << 3 | q >> 5) ^ (q << 4 | q >> 4)
+        sbox[p] = (x ^ 0x63) & 0xFF
+        if p == 1:
+            break
+    sbox[0] = 0x63
+    SBOX.extend(sbox)
+    for i, s in enumerate(SBOX):
+        INV[s] = i
+
+
+_init()
+
+
+def xtime(a):
+    return ((a << 1) ^ 0x1B) & 0xFF if a & 0x80 else a << 1
+
+
+def mul(a, b):
+    r = 0
+    while b:
+        if b & 1:
+            r ^= a
+        a = xtime(a)
+        b >>= 1
+    return r
+
+
+def expand(key):
+    assert len(key) == 32
+    w = [list(key[i:i + 4]) for i in range(0, 32, 4)]
+    rcon = 1
+    for i in range(8, 60):
+        t = list(w[i - 1])
+        if i % 8 == 0:
+            t = [SBOX[b] for b in t[1:] + t[:1]]
+            t[0] ^= rcon
+            rcon = xtime(rcon)
+        elif i % 8 == 4:
+            t = [SBOX[b] for b in t]
+        w.append([a ^ b for a, b in zip(w[i - 8], t)])
+    return [sum(w[r * 4:r * 4 + 4], []) for r in range(15)]
+
+
+def encrypt_block(rk, block):
+    s = [a ^ b for a, b in zip(block, rk[0])]
+    for r in range(1, 15):
+        s = [SBOX[b] for b in s]
+        s = [s[(i + 4 * (i % 4)) % 16] for i in range(16)]
+        if r != 14:
+            m = []
+            for c in range(4):
+                a = s[4 * c:4 * c + 4]
+                m += [mul(a[0], 2) ^ mul(a[1], 3) ^ a[2] ^ a[3],
+                      a[0] ^ mul(a[1], 2) ^ mul(a[2], 3) ^ a[3],
+                      a[0] ^ a[1] ^ mul(a[2], 2) ^ mul(a[3], 3),
+                      mul(a[0], 3) ^ a[1] ^ a[2] ^ mul(a[3], 2)]
+            s = m
+        s = [a ^ b for a, b in zip(s, rk[r])]
+    return bytes(s)
+
+
+def decrypt_block(rk, block):
+    s = [a ^ b for a, b in zip(block, rk[14])]
+    for r in range(13, -1, -1):
+        s = [s[(i - 4 * (i % 4)) % 16] for i in range(16)]
+        s = [INV[b] for b in s]
+        s = [a ^ b for a, b in zip(s, rk[r])]
+        if r:
+            m = []
+            for c in range(4):
+                a = s[4 * c:4 * c + 4]
+                m += [mul(a[0], 14) ^ mul(a[1], 11) ^ mul(a[2], 13) ^ mul(a[3], 9),
+                      mul(a[0], 9) ^ mul(a[1], 14) ^ mul(a[2], 11) ^ mul(a[3], 13),
+                      mul(a[0], 13) ^ mul(a[1], 9) ^ mul(a[2], 14) ^ mul(a[3], 11),
+                      mul(a[0], 11) ^ mul(a[1], 13) ^ mul(a[2], 9) ^ mul(a[3], 14)]
+            s = m
+    return bytes(s)
+
+
+def crypt(mode, key, iv, data):
+    """One aes_crypt call, returns (output, updated iv)."""
+    rk = expand(key)
+    out = bytearray()
+    for i in range(0, len(data), 16):
+        block = data[i:i + 16]
+        if mode == 'ctr':
+            ks = encrypt_block(rk, iv)
+            out += bytes(a ^ b for a, b in zip(block, ks))
+            iv = ((int.from_bytes(iv, 'big') + 1) % (1 << 128)).to_bytes(16, 'big')
+        elif mode == 'cbc-encrypt':
+            iv = encrypt_block(rk, bytes(a ^ b for a, b in zip(block, iv)))
+            out += iv
+        else:
+            out += bytes(a ^ b for a, b in zip(decrypt_block(rk, block), iv))
+            iv = block
+    return bytes(out), iv
+
+
+KEY = bytes.fromhex('603deb1015ca71be2b73aef0857d7781'
+                    '1f352c073b6108d72d9810a30914dff4')
+PLAIN = bytes.fromhex('6bc1bee22e409f96e93d7e117393172a'
+                      'ae2d8a571e03ac9c9eb76fac45af8e51'
+                      '30c81c46a35ce411e5fbc1191a0a52ef'
+                      'f69f2445df4f9b17ad2b417be66c3710')
+VECTORS = [
+    ('cbc', bytes.fromhex('000102030405060708090a0b0c0d0e0f'),
+     bytes.fromhex('f58c4c04d6e5f1ba779eabfb5f7bfbd6'
+                   '9cfc4e967edb808d679f777bc6702c7d'
+                   '39f23369a9d9bacfa530e26304231461'
+                   'b2eb05e2c39be9fcda6c19078c6a9d1b')),
+    ('ctr', bytes.fromhex('f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff'),
+     bytes.fromhex('601ec313775789a5b7a7f504bbf3d228'
+                   'f443e3ca4d62b59aca84e990cacaf5c5'
+                   '2b0930daa23de94ce87017ba2d84988d'
+                   'dfc9c58db67aada613c2dd08457941a6')),
+]
+
+
+def run():
+    ok = True
+    for name, iv, cipher in VECTORS:
+        forward = 'ctr' if name == 'ctr' else 'cbc-encrypt'
+        back = 'ctr' if name == 'ctr' else 'cbc-decrypt'
+        for mode, src, want in ((forward, PLAIN, cipher), (back, cipher, PLAIN)):
+            whole, last = crypt(mode, KEY, iv, src)
+            a, mid = crypt(mode, KEY, iv, src[:16])     # streamed in two calls
+            b, end = crypt(mode, KEY, mid, src[16:])
+            good = whole == want and a + b == want and last == end
+            print('%-12s %s' % (mode, 'pass' if good else 'FAIL'))
+            ok &= good
+    short, _ = crypt('ctr', KEY, VECTORS[1][1], PLAIN[:23])
+    good = short == VECTORS[1][2][:23]
+    print('%-12s %s' % ('ctr 23 bytes', 'pass' if good else 'FAIL'))
+    return ok and good
+
+
+def c_array(name, data):
+    rows = ['    ' + ', '.join('0x%02X' % b for b in data[i:i + 16]) for i in range(0, len(data), 16)]
+    return 'static const uint8_t %s[%d] = {\n%s\n};' % (name, len(data), ',\n'.join(rows))
+
+
+if __name__ == '__main__':
+    if sys.argv[1:] == ['-c']:
+        print(c_array('ucKatKey', KEY))
+        print(c_array('ucKatPlain', PLAIN))
+        for name, iv, cipher in VECTORS:
+            print(c_array('ucKat%sIV' % name.capitalize(), iv))
+            print(c_array('ucKat%sCipher' % name.capitalize(), cipher))
+    else:
+        sys.exit(0 if run() else 1)
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+# Author:      Mohd A. Zainol
+# Date:        16 Oct 2026
+# File:        crc_tables.py
+# Function:    Generate the lookup tables of crcSoft.c
+#
+# Usage: python3 crc_tables.py > ../crcTable.c
+#        python3 crc_tables.py --check ../crcTable.c
+#
+# --check exits nonzero if the file is not what this script makes, line
+# endings aside (the file in the tree has CRLF).
+#
+# crc32 tables: reflected CRC-32 (0xEDB88320), 8 tables for slice-by-8,
+#               table k advances a byte through k further zero bytes
+# crc16 table:  CRC-16/CCITT (0x1021), MSB first
+
+import sys
+
+POLY32 = 0xEDB88320
+POLY16 = 0x1021
+
+
+def table32():
+    t = [[0] * 256 for _ in range(8)]
+    for i in range(256):
+        c = i
+        for _ in range(8):
+            c = (c >> 1) ^ POLY32 if c & 1 else c >> 1
+        t[0][i] = c
+    for k in range(1, 8):
+        for i in range(256):
+            c = t[k - 1][i]
+            t[k][i] = (c >> 8) ^ t[0][c & 0xFF]
+    return t
+
+
+def table16():
+    t = []
+    for i in range(256):
+        c = i << 8
+        for _ in range(8):
+            c = ((c << 1) ^ POLY16) if c & 0x8000 else c << 1
+        t.append(c & 0xFFFF)
+    return t
+
+
+def rows(values, fmt, per_line):
+    for i in range(0, len(values), per_line):
+        yield '    ' + ', '.join(fmt % v for v in values[i:i + per_line]) + ','
+
+
+def source():
+    out = ['// Generated by tools/crc_tables.py, do not edit',
+           '',
+           '#include <stdint.h>',
+           '#include "crcSoft.h"',
+           '',
+           'const uint32_t crcSoft_table32[8][256] = {']
+    for k, t in enumerate(table32()):
+        out.append('  { // table %d' % k)
+        out.extend(rows(t, '0x%08X', 6))
+        out.append('  },')
+    out.append('};')
+    out.append('')
+    out.append('const uint16_t crcSoft_table16[256] = {')
+    out.extend(rows(table16(), '0x%04X', 8))
+    out.append('};')
+    return out
+
+
+def check(path):
+    with open(path, newline='') as f:
+        have = f.read().replace('\r\n', '\n').split('\n')
+    if have and have[-1] == '':
+        have.pop()
+    want = source()
+    for i, (a, b) in enumerate(zip(have, want)):
+        if a != b:
+            print('%s:%d: differs from crc_tables.py' % (path, i + 1))
+            return 1
+    if len(have) != len(want):
+        print('%s: %d lines, crc_tables.py makes %d' % (path, len(have), len(want)))
+        return 1
+    print('%s: ok' % path)
+    return 0
+
+
+def main():
+    if len(sys.argv) == 3 and sys.argv[1] == '--check':
+        sys.exit(check(sys.argv[2]))
+    for line in source():
+        print(line)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,40 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        FreeRTOS.h
+// Function:    The parts of FreeRTOS.h and FreeRTOSConfig.h the host tests need
+//
+// Tasks are POSIX threads and a tick is 1ms of real time, see hostRtos.c.
+
+#ifndef HOST_FREERTOS_H_
+#define HOST_FREERTOS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "driverlib.h"
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+#define portBASE_TYPE           long
+
+#define pdFALSE                 ( ( BaseType_t ) 0 )
+#define pdTRUE                  ( ( BaseType_t ) 1 )
+#define pdFAIL                  ( pdFALSE )
+#define pdPASS                  ( pdTRUE )
+#define portMAX_DELAY           ( TickType_t ) 0xffffffffUL
+
+// As in ../../FreeRTOSConfig.h
+#define configTICK_RATE_HZ                      ( ( TickType_t ) 1000 )
+#define configMINIMAL_STACK_SIZE                ( ( unsigned short ) 100 )
+#define configPRIO_BITS                         3
+#define configLIBRARY_LOWEST_INTERRUPT_PRIORITY 0x07
+#define configKERNEL_INTERRUPT_PRIORITY         ( configLIBRARY_LOWEST_INTERRUPT_PRIORITY << (8 - configPRIO_BITS) )
+
+#define pdMS_TO_TICKS( xTimeInMs ) ( ( TickType_t ) ( ( ( TickType_t ) ( xTimeInMs ) * ( TickType_t ) configTICK_RATE_HZ ) / ( TickType_t ) 1000 ) )
+
+void Host_Assert(const char *file, int line);
+#define configASSERT( x )       if( ( x ) == 0 ) Host_Assert( __FILE__, __LINE__ )
+
+#define portYIELD_FROM_ISR( x ) ( void ) ( x )
+
+#endif
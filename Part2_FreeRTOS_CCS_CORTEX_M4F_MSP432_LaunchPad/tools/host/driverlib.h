@@ -0,0 +1,140 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        driverlib.h
+// Function:    Host model of the driverlib calls used by the demo
+//
+// The constants are those of ../../driverlib.  The UART calls are in
+// hostUart.c.  The DMA calls work on the channel model in hostModel.c, which moves data when a test raises a
+// request with Host_DmaRequest, the way the uDMA does for a trigger.
+
+#ifndef HOST_DRIVERLIB_H_
+#define HOST_DRIVERLIB_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "msp.h"
+
+// interrupt.h
+#define INT_EUSCIA0             (32)
+#define INT_DMA_INT3            (47)
+#define INT_DMA_INT2            (48)
+#define INT_DMA_INT1            (49)
+#define INT_DMA_INT0            (50)
+
+void Interrupt_setPriority(uint32_t interruptNumber, uint8_t priority);
+void Interrupt_enableInterrupt(uint32_t interruptNumber);
+void Interrupt_disableInterrupt(uint32_t interruptNumber);
+#define MAP_Interrupt_setPriority       Interrupt_setPriority
+#define MAP_Interrupt_enableInterrupt   Interrupt_enableInterrupt
+#define MAP_Interrupt_disableInterrupt  Interrupt_disableInterrupt
+
+// cs.h
+uint32_t CS_getSMCLK(void);
+#define MAP_CS_getSMCLK                 CS_getSMCLK
+
+// uart.h, module instances are host addresses
+#define EUSCI_A_UART_NO_PARITY                          0x00
+#define EUSCI_A_UART_LSB_FIRST                          0x00
+#define EUSCI_A_UART_MODE                               0x00
+#define EUSCI_A_UART_CLOCKSOURCE_SMCLK                  0x80
+#define EUSCI_A_UART_ONE_STOP_BIT                       0x00
+#define EUSCI_A_UART_OVERSAMPLING_BAUDRATE_GENERATION   0x01
+#define EUSCI_A_UART_LOW_FREQUENCY_BAUDRATE_GENERATION  0x00
+#define EUSCI_A_UART_RECEIVE_INTERRUPT                  0x0001
+#define EUSCI_A_UART_TRANSMIT_INTERRUPT                 0x0002
+#define EUSCI_A_UART_RECEIVE_INTERRUPT_FLAG             0x0001
+#define EUSCI_A_UART_TRANSMIT_INTERRUPT_FLAG            0x0002
+#define EUSCI_A_UART_BUSY                               0x0001
+
+typedef struct _eUSCI_eUSCI_UART_Config
+{
+    uint_fast8_t selectClockSource;
+    uint_fast16_t clockPrescalar;
+    uint_fast8_t firstModReg;
+    uint_fast8_t secondModReg;
+    uint_fast8_t parity;
+    uint_fast16_t msborLsbFirst;
+    uint_fast16_t numberofStopBits;
+    uint_fast16_t uartMode;
+    uint_fast8_t overSampling;
+} eUSCI_UART_Config;
+
+bool UART_initModule(uintptr_t moduleInstance, const eUSCI_UART_Config *config);
+void UART_enableModule(uintptr_t moduleInstance);
+void UART_enableInterrupt(uintptr_t moduleInstance, uint_fast8_t mask);
+void UART_disableInterrupt(uintptr_t moduleInstance, uint_fast8_t mask);
+void UART_clearInterruptFlag(uintptr_t moduleInstance, uint_fast8_t mask);
+uint_fast8_t UART_getEnabledInterruptStatus(uintptr_t moduleInstance);
+uint_fast8_t UART_queryStatusFlags(uintptr_t moduleInstance, uint_fast8_t mask);
+uintptr_t UART_getTransmitBufferAddressForDMA(uintptr_t moduleInstance);
+#define MAP_UART_initModule             UART_initModule
+#define MAP_UART_enableModule           UART_enableModule
+#define MAP_UART_enableInterrupt        UART_enableInterrupt
+#define MAP_UART_disableInterrupt       UART_disableInterrupt
+#define MAP_UART_clearInterruptFlag     UART_clearInterruptFlag
+#define MAP_UART_getEnabledInterruptStatus UART_getEnabledInterruptStatus
+#define MAP_UART_queryStatusFlags       UART_queryStatusFlags
+#define MAP_UART_getTransmitBufferAddressForDMA UART_getTransmitBufferAddressForDMA
+
+// dma.h
+#define UDMA_ATTR_USEBURST      0x00000001
+#define UDMA_ATTR_ALTSELECT     0x00000002
+#define UDMA_ATTR_HIGH_PRIORITY 0x00000004
+#define UDMA_ATTR_REQMASK       0x00000008
+#define UDMA_ATTR_ALL           0x0000000F
+
+#define UDMA_MODE_STOP          0x00000000
+#define UDMA_MODE_BASIC         0x00000001
+#define UDMA_MODE_AUTO          0x00000002
+#define UDMA_MODE_PINGPONG      0x00000003
+
+#define UDMA_DST_INC_8          0x00000000
+#define UDMA_DST_INC_16         0x40000000
+#define UDMA_DST_INC_32         0x80000000
+#define UDMA_DST_INC_NONE       0xc0000000
+#define UDMA_SRC_INC_8          0x00000000
+#define UDMA_SRC_INC_16         0x04000000
+#define UDMA_SRC_INC_32         0x08000000
+#define UDMA_SRC_INC_NONE       0x0c000000
+#define UDMA_SIZE_8             0x00000000
+#define UDMA_SIZE_16            0x11000000
+#define UDMA_SIZE_32            0x22000000
+#define UDMA_ARB_1              0x00000000
+
+#define UDMA_PRI_SELECT         0x00000000
+#define UDMA_ALT_SELECT         0x00000008
+
+#define DMA_CH0_EUSCIA0TX       0x01000000
+#define DMA_CH1_TIMERA0CCR2     0x06000001
+#define DMA_CH7_RESERVED0       0x00000007
+
+#define DMA_INT0                INT_DMA_INT0
+#define DMA_INT1                INT_DMA_INT1
+#define DMA_INT2                INT_DMA_INT2
+#define DMA_INT3                INT_DMA_INT3
+
+void DMA_assignChannel(uint32_t mapping);
+void DMA_enableChannelAttribute(uint32_t channelNum, uint32_t attr);
+void DMA_disableChannelAttribute(uint32_t channelNum, uint32_t attr);
+void DMA_setChannelControl(uint32_t channelStructIndex, uint32_t control);
+void DMA_setChannelTransfer(uint32_t channelStructIndex, uint32_t mode,
+        void *srcAddr, void *dstAddr, uint32_t transferSize);
+uint32_t DMA_getChannelMode(uint32_t channelStructIndex);
+void DMA_enableChannel(uint32_t channelNum);
+void DMA_disableChannel(uint32_t channelNum);
+bool DMA_isChannelEnabled(uint32_t channelNum);
+void DMA_assignInterrupt(uint32_t interruptNumber, uint32_t channel);
+void DMA_clearInterruptFlag(uint32_t channel);
+#define MAP_DMA_assignChannel           DMA_assignChannel
+#define MAP_DMA_enableChannelAttribute  DMA_enableChannelAttribute
+#define MAP_DMA_disableChannelAttribute DMA_disableChannelAttribute
+#define MAP_DMA_setChannelControl       DMA_setChannelControl
+#define MAP_DMA_setChannelTransfer      DMA_setChannelTransfer
+#define MAP_DMA_getChannelMode          DMA_getChannelMode
+#define MAP_DMA_enableChannel           DMA_enableChannel
+#define MAP_DMA_disableChannel          DMA_disableChannel
+#define MAP_DMA_isChannelEnabled        DMA_isChannelEnabled
+#define MAP_DMA_assignInterrupt         DMA_assignInterrupt
+#define MAP_DMA_clearInterruptFlag      DMA_clearInterruptFlag
+
+#endif
@@ -0,0 +1,142 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        hostFlash.c
+// Function:    NOR flash model behind kvFlash.h, kept in a file
+//
+// Replaces kvFlash.c for the host tests.  The store's sectors are a file
+// mapped into memory, so its contents survive the program and can be
+// looked at with a hex dump.  NOR rules: an erase sets a whole sector to
+// 0xFF, a program can only clear bits, and a program that would need a
+// bit set fails its verify as the ROM call does.
+//
+// Power failure: during call Host_FlashCutAt the model stops part way.
+// A program has done its first bytes, maybe all of them, and left the
+// next one with only some of its bits cleared.  An erase has left each
+// flash word of the sector as it was, erased, or with some of its bits
+// set.  Then it longjmps to Host_FlashPowerFail, as if the board had
+// reset.
+
+#include <stdint.h>
+#include <string.h>
+#include <setjmp.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "kvFlash.h"
+#include "hostFlash.h"
+
+uint8_t *Host_Flash;
+uint32_t Host_FlashOps;
+uint32_t Host_FlashCutAt;
+jmp_buf Host_FlashPowerFail;
+uint32_t Host_FlashReprograms;
+
+// 1 for each flash word programmed since its sector was erased
+static uint8_t Programmed[HOST_FLASH_SIZE/HOST_FLASH_WORD];
+static uint32_t Random = 1;
+
+static uint8_t Host_FlashRandom(void){
+  Random = Random*1103515245 + 12345;
+  return (uint8_t)(Random >> 16);
+}
+
+int Host_FlashOpen(const char *path){
+  int fd = open(path, O_RDWR | O_CREAT, 0644);
+  off_t size;
+  void *p;
+  if(fd < 0) return 0;
+  size = lseek(fd, 0, SEEK_END);
+  if((size != HOST_FLASH_SIZE) && (ftruncate(fd, HOST_FLASH_SIZE) != 0)){
+    close(fd);
+    return 0;
+  }
+  p = mmap(NULL, HOST_FLASH_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if(p == MAP_FAILED) return 0;
+  Host_Flash = (uint8_t *)p;
+  if(size != HOST_FLASH_SIZE) Host_FlashErase();
+  return 1;
+}
+
+void Host_FlashErase(void){
+  memset(Host_Flash, 0xFF, HOST_FLASH_SIZE);
+  memset(Programmed, 0, sizeof(Programmed));
+}
+
+void Host_FlashClose(void){
+  munmap(Host_Flash, HOST_FLASH_SIZE);
+  Host_Flash = NULL;
+}
+
+// Count the call, 1 if power fails during it
+static int Host_FlashCut(void){
+  Host_FlashOps++;
+  if(Host_FlashCutAt && (Host_FlashOps == Host_FlashCutAt)){
+    Host_FlashCutAt = 0;
+    return 1;
+  }
+  return 0;
+}
+
+// kvFlash.c
+void kvFlash_init(void){}
+
+void kvFlash_read(uint32_t offset, void *buf, uint32_t len){
+  memcpy(buf, &Host_Flash[offset], len);
+}
+
+int kvFlash_program(uint32_t offset, const void *data, uint32_t len){
+  const uint8_t *d = (const uint8_t *)data;
+  uint32_t i, w, cut = len;
+  int fail = Host_FlashCut();
+  if(fail){
+    cut = Host_FlashRandom()%(len + 1);
+  }
+  for(w = offset/HOST_FLASH_WORD; w <= (offset + len - 1)/HOST_FLASH_WORD; w++){
+    if(Programmed[w]) Host_FlashReprograms++;
+  }
+  for(i = 0; i < cut; i++){
+    Host_Flash[offset + i] &= d[i];
+  }
+  if(cut < len){
+    Host_Flash[offset + cut] &= d[cut] | Host_FlashRandom();
+  }
+  // a cut short program only counts for the words it changed
+  for(w = offset/HOST_FLASH_WORD; w <= (offset + len - 1)/HOST_FLASH_WORD; w++){
+    for(i = 0; (cut < len) && (i < HOST_FLASH_WORD) &&
+               (Host_Flash[w*HOST_FLASH_WORD + i] == 0xFF); i++){}
+    if(i < HOST_FLASH_WORD) Programmed[w] = 1;
+  }
+  if(fail){
+    longjmp(Host_FlashPowerFail, 1);
+  }
+  return memcmp(&Host_Flash[offset], d, len) == 0;
+}
+
+int kvFlash_erase(uint32_t offset){
+  uint32_t i, w;
+  offset -= offset%KV_SECTOR_SIZE;
+  if(Host_FlashCut()){
+    for(w = offset/HOST_FLASH_WORD; w < (offset + KV_SECTOR_SIZE)/HOST_FLASH_WORD; w++){
+      switch(Host_FlashRandom()%3){
+        case 0: break;                    // not reached yet
+        case 1: memset(&Host_Flash[w*HOST_FLASH_WORD], 0xFF, HOST_FLASH_WORD); break;
+        default:
+          for(i = 0; i < HOST_FLASH_WORD; i++){
+            Host_Flash[w*HOST_FLASH_WORD + i] |= Host_FlashRandom();
+          }
+      }
+    }
+    for(w = offset/HOST_FLASH_WORD; w < (offset + KV_SECTOR_SIZE)/HOST_FLASH_WORD; w++){
+      for(i = 0; (i < HOST_FLASH_WORD) && (Host_Flash[w*HOST_FLASH_WORD + i] == 0xFF); i++){}
+      if(i == HOST_FLASH_WORD) Programmed[w] = 0;
+    }
+    longjmp(Host_FlashPowerFail, 1);
+  }
+  memset(&Host_Flash[offset], 0xFF, KV_SECTOR_SIZE);
+  memset(&Programmed[offset/HOST_FLASH_WORD], 0, KV_SECTOR_SIZE/HOST_FLASH_WORD);
+  return 1;
+}
+
+void kvFlash_lock(void){}
+void kvFlash_unlock(void){}
@@ -0,0 +1,57 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        hostFlash.h
+// Function:    header file of hostFlash.c
+
+#ifndef HOSTFLASH_H_
+#define HOSTFLASH_H_
+
+#include <stdint.h>
+#include <setjmp.h>
+#include "kvStore.h"
+
+#define HOST_FLASH_SIZE     (KV_SECTORS*KV_SECTOR_SIZE)
+#define HOST_FLASH_WORD     16
+
+// The store's flash, mapped from the file given to Host_FlashOpen
+extern uint8_t *Host_Flash;
+
+// Program and erase calls made so far
+extern uint32_t Host_FlashOps;
+
+// Power fails part way through call number Host_FlashCutAt, 0 never.
+// The model then jumps to Host_FlashPowerFail and clears Host_FlashCutAt.
+extern uint32_t Host_FlashCutAt;
+extern jmp_buf Host_FlashPowerFail;
+
+// Flash words programmed a second time without an erase in between
+extern uint32_t Host_FlashReprograms;
+
+/**
+ * Map the simulated flash from a file
+ *
+ * @param  path is the file, made and erased if it is not the right size
+ * @return 1 if the flash is mapped, 0 if the file could not be used
+ * @brief  Open the flash file
+ */
+int Host_FlashOpen(const char *path);
+
+/**
+ * Erase the whole simulated flash
+ *
+ * @param  none
+ * @return none
+ * @brief  Blank flash, as from the factory
+ */
+void Host_FlashErase(void);
+
+/**
+ * Unmap the flash file, which keeps the contents
+ *
+ * @param  none
+ * @return none
+ * @brief  Close the flash file
+ */
+void Host_FlashClose(void);
+
+#endif
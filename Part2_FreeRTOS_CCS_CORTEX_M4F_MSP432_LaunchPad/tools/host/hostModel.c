@@ -0,0 +1,122 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        hostModel.c
+// Function:    Register and DMA model behind the host tests
+//
+// Replaces the device registers, dmaTable.c and the driverlib DMA and
+// interrupt calls for the host tests.  Data only moves when a test calls Host_DmaRequest.
+
+#include <stdint.h>
+#include <string.h>
+#include "msp.h"
+#include "driverlib.h"
+#include "hostModel.h"
+
+DIO_PORT_Interruptable_Type Host_P[11];
+Timer_A_Type Host_TimerA[4];
+Host_DmaChannel_t Host_Dma[8];
+uint32_t Host_DmaDone;
+uint64_t Host_IntEnabled;
+int Host_Failures;
+
+void Host_Reset(void){
+  memset(Host_P, 0, sizeof(Host_P));
+  memset(Host_TimerA, 0, sizeof(Host_TimerA));
+  memset(Host_Dma, 0, sizeof(Host_Dma));
+  Host_DmaDone = 0;
+  Host_IntEnabled = 0;
+}
+
+int Host_Result(const char *name){
+  printf("%s: %s\n", name, Host_Failures ? "FAILED" : "ok");
+  return Host_Failures != 0;
+}
+
+// interrupt.c
+void Interrupt_setPriority(uint32_t interruptNumber, uint8_t priority){}
+void Interrupt_enableInterrupt(uint32_t interruptNumber){
+  Host_IntEnabled |= (uint64_t)1<<interruptNumber;
+}
+void Interrupt_disableInterrupt(uint32_t interruptNumber){
+  Host_IntEnabled &= ~((uint64_t)1<<interruptNumber);
+}
+
+// dmaTable.c, the model needs no control table
+void dmaTable_init(void){}
+
+// dma.c
+static Host_DmaStruct_t *Host_DmaStruct(uint32_t channelStructIndex){
+  return &Host_Dma[channelStructIndex&7].ctl[(channelStructIndex&UDMA_ALT_SELECT) ? 1 : 0];
+}
+
+void DMA_assignChannel(uint32_t mapping){
+  Host_Dma[mapping&7].mapping = mapping;
+}
+void DMA_enableChannelAttribute(uint32_t channelNum, uint32_t attr){
+  Host_Dma[channelNum&7].attr |= attr;
+}
+void DMA_disableChannelAttribute(uint32_t channelNum, uint32_t attr){
+  Host_Dma[channelNum&7].attr &= ~attr;
+}
+void DMA_setChannelControl(uint32_t channelStructIndex, uint32_t control){
+  Host_DmaStruct(channelStructIndex)->control = control;
+}
+void DMA_setChannelTransfer(uint32_t channelStructIndex, uint32_t mode,
+        void *srcAddr, void *dstAddr, uint32_t transferSize){
+  Host_DmaStruct_t *s = Host_DmaStruct(channelStructIndex);
+  s->mode = mode;
+  s->src = (const uint8_t *)srcAddr;
+  s->dst = (uint8_t *)dstAddr;
+  s->count = transferSize;
+}
+uint32_t DMA_getChannelMode(uint32_t channelStructIndex){
+  return Host_DmaStruct(channelStructIndex)->mode;
+}
+void DMA_enableChannel(uint32_t channelNum){
+  Host_Dma[channelNum&7].enabled = 1;
+}
+void DMA_disableChannel(uint32_t channelNum){
+  Host_Dma[channelNum&7].enabled = 0;
+}
+bool DMA_isChannelEnabled(uint32_t channelNum){
+  return Host_Dma[channelNum&7].enabled != 0;
+}
+void DMA_assignInterrupt(uint32_t interruptNumber, uint32_t channel){}
+void DMA_clearInterruptFlag(uint32_t channel){
+  Host_DmaDone &= ~(1u<<(channel&7));
+}
+
+// Step of a pointer for an increment field, 3 is no increment
+static uint32_t Host_DmaStep(uint32_t inc){
+  return (inc == 3) ? 0 : 1u<<inc;
+}
+
+int Host_DmaRequest(uint32_t channel){
+  Host_DmaChannel_t *c = &Host_Dma[channel&7];
+  Host_DmaStruct_t *s;
+  uint32_t size;
+  if(!c->enabled) return 0;
+  s = &c->ctl[(c->attr&UDMA_ATTR_ALTSELECT) ? 1 : 0];
+  if((s->mode == UDMA_MODE_STOP) || (s->count == 0)){
+    c->enabled = 0;
+    return 0;
+  }
+  size = 1u<<((s->control>>24)&3);
+  memcpy(s->dst, s->src, size);
+  s->src += Host_DmaStep((s->control>>26)&3);
+  s->dst += Host_DmaStep((s->control>>30)&3);
+  if(--s->count == 0){
+    Host_DmaDone |= 1u<<(channel&7);
+    if(s->mode == UDMA_MODE_PINGPONG){
+      s->mode = UDMA_MODE_STOP;
+      c->attr ^= UDMA_ATTR_ALTSELECT;
+      if(c->ctl[(c->attr&UDMA_ATTR_ALTSELECT) ? 1 : 0].mode == UDMA_MODE_STOP){
+        c->enabled = 0;
+      }
+    }else{
+      s->mode = UDMA_MODE_STOP;
+      c->enabled = 0;
+    }
+  }
+  return 1;
+}
@@ -0,0 +1,62 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        hostModel.h
+// Function:    header file of hostModel.c
+
+#ifndef HOSTMODEL_H_
+#define HOSTMODEL_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+// One uDMA control structure
+typedef struct {
+  uint32_t mode;            // UDMA_MODE_*, UDMA_MODE_STOP once done
+  uint32_t control;         // size and increments, see DMA_setChannelControl
+  const uint8_t *src;       // next item to read
+  uint8_t *dst;             // next item to write
+  uint32_t count;           // items left
+} Host_DmaStruct_t;
+
+// One uDMA channel, ctl[0] primary and ctl[1] alternate
+typedef struct {
+  Host_DmaStruct_t ctl[2];
+  uint32_t attr;            // UDMA_ATTR_*, ALTSELECT picks the structure in use
+  uint32_t mapping;         // from DMA_assignChannel
+  int enabled;
+} Host_DmaChannel_t;
+
+extern Host_DmaChannel_t Host_Dma[8];
+extern uint32_t Host_DmaDone;       // completion flags, bit n for channel n
+extern uint64_t Host_IntEnabled;    // bit n for interrupt number n
+
+/**
+ * Clear every register and the DMA model
+ *
+ * @param  none
+ * @return none
+ * @brief  Power-on reset of the model
+ */
+void Host_Reset(void);
+
+/**
+ * Raise one trigger of a DMA channel
+ *
+ * @param  channel is the channel number, 0 to 7
+ * @return 1 if an item was moved, 0 if the channel is disabled or stopped
+ * @note   Moves one item (UDMA_ARB_1).  When the structure in use runs
+ *         out its mode becomes UDMA_MODE_STOP, the completion flag of
+ *         the channel is set and, in ping-pong mode, the channel moves
+ *         on to the other structure.  A basic transfer, or a ping-pong
+ *         that moves on to a stopped structure, disables the channel.
+ * @brief  DMA request
+ */
+int Host_DmaRequest(uint32_t channel);
+
+// Test bookkeeping: CHECK counts and prints failures, main returns Host_Result
+extern int Host_Failures;
+#define CHECK(cond) do{ if(!(cond)){ Host_Failures++; \
+    printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); } }while(0)
+int Host_Result(const char *name);
+
+#endif
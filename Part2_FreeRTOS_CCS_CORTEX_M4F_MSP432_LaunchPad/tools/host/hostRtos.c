@@ -0,0 +1,171 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        hostRtos.c
+// Function:    FreeRTOS calls on POSIX threads for the host tests
+//
+// Each task is a thread and a tick is 1ms of real time.  The threads
+// really run in parallel, which only makes races easier to hit than on
+// one core.  taskENTER_CRITICAL and the interrupt handlers run by the
+// models hold one recursive lock, like masking interrupts.  Notifications
+// are counters with a condition variable.
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#include <errno.h>
+#include <unistd.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+#include "CortexM.h"
+#include "hostModel.h"
+
+struct Host_Task {
+  TaskFunction_t code;
+  void *param;
+  uint32_t notify;
+  pthread_cond_t wake;
+};
+
+static pthread_mutex_t Kernel = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static pthread_mutex_t NotifyLock = PTHREAD_MUTEX_INITIALIZER;
+static __thread struct Host_Task *Current;
+
+void Host_Assert(const char *file, int line){
+  printf("%s:%d: configASSERT failed\n", file, line);
+  exit(2);
+}
+
+void Host_EnterCritical( void ){
+  pthread_mutex_lock(&Kernel);
+}
+
+void Host_ExitCritical( void ){
+  pthread_mutex_unlock(&Kernel);
+}
+
+static struct Host_Task *Host_NewTask(TaskFunction_t code, void *param){
+  struct Host_Task *t = calloc(1, sizeof(*t));
+  pthread_condattr_t attr;
+  t->code = code;
+  t->param = param;
+  pthread_condattr_init(&attr);
+  pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  pthread_cond_init(&t->wake, &attr);
+  return t;
+}
+
+static void *Host_TaskStart(void *arg){
+  Current = arg;
+  Current->code(Current->param);
+  return NULL;
+}
+
+BaseType_t xTaskCreate( TaskFunction_t pxTaskCode, const char * const pcName,
+        const uint16_t usStackDepth, void * const pvParameters,
+        UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask ){
+  struct Host_Task *t = Host_NewTask(pxTaskCode, pvParameters);
+  pthread_t thread;
+  if(pxCreatedTask) *pxCreatedTask = t;
+  if(pthread_create(&thread, NULL, Host_TaskStart, t)) return pdFAIL;
+  pthread_detach(thread);
+  return pdPASS;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle( void ){
+  if(Current == NULL) Current = Host_NewTask(NULL, NULL);   // main
+  return Current;
+}
+
+TickType_t xTaskGetTickCount( void ){
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (TickType_t)(ts.tv_sec*1000 + ts.tv_nsec/1000000);
+}
+
+void vTaskDelay( const TickType_t xTicksToDelay ){
+  usleep(xTicksToDelay*1000);
+}
+
+void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut ){
+  pxTimeOut->xOverflowCount = 0;
+  pxTimeOut->xTimeOnEntering = xTaskGetTickCount();
+}
+
+BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut, TickType_t * const pxTicksToWait ){
+  TickType_t now = xTaskGetTickCount(), elapsed;
+  if(*pxTicksToWait == portMAX_DELAY) return pdFALSE;
+  elapsed = now - pxTimeOut->xTimeOnEntering;
+  if(elapsed >= *pxTicksToWait){
+    *pxTicksToWait = 0;
+    return pdTRUE;
+  }
+  *pxTicksToWait -= elapsed;
+  pxTimeOut->xTimeOnEntering = now;
+  return pdFALSE;
+}
+
+uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait ){
+  struct Host_Task *t = xTaskGetCurrentTaskHandle();
+  struct timespec until;
+  uint32_t value;
+  clock_gettime(CLOCK_MONOTONIC, &until);
+  until.tv_sec += xTicksToWait/1000;
+  until.tv_nsec += (long)(xTicksToWait%1000)*1000000;
+  if(until.tv_nsec >= 1000000000){
+    until.tv_sec++;
+    until.tv_nsec -= 1000000000;
+  }
+  pthread_mutex_lock(&NotifyLock);
+  while((t->notify == 0) && xTicksToWait){
+    if(xTicksToWait == portMAX_DELAY){
+      pthread_cond_wait(&t->wake, &NotifyLock);
+    }else if(pthread_cond_timedwait(&t->wake, &NotifyLock, &until) == ETIMEDOUT){
+      break;
+    }
+  }
+  value = t->notify;
+  if(value){
+    t->notify = xClearCountOnExit ? 0 : value - 1;
+  }
+  pthread_mutex_unlock(&NotifyLock);
+  return value;
+}
+
+BaseType_t xTaskNotifyGive( TaskHandle_t xTaskToNotify ){
+  pthread_mutex_lock(&NotifyLock);
+  xTaskToNotify->notify++;
+  pthread_cond_signal(&xTaskToNotify->wake);
+  pthread_mutex_unlock(&NotifyLock);
+  return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken ){
+  xTaskNotifyGive(xTaskToNotify);
+  if(pxHigherPriorityTaskWoken) *pxHigherPriorityTaskWoken = pdTRUE;
+}
+
+// Nothing is received in the host tests
+StreamBufferHandle_t xStreamBufferCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes ){
+  static char buffer;
+  return (StreamBufferHandle_t)&buffer;
+}
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData,
+        size_t xBufferLengthBytes, TickType_t xTicksToWait ){
+  vTaskDelay(xTicksToWait == portMAX_DELAY ? 1000 : xTicksToWait);
+  return 0;
+}
+size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvData,
+        size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken ){
+  return 0;
+}
+BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevel ){
+  return pdPASS;
+}
+
+// CortexM.c, LDREX/STREX there
+uint32_t CompareAndSwap(volatile uint32_t *addr, uint32_t oldval, uint32_t newval){
+  return __sync_bool_compare_and_swap(addr, oldval, newval) ? 1 : 0;
+}
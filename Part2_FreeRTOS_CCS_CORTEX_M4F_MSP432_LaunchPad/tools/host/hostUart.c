@@ -0,0 +1,122 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        hostUart.c
+// Function:    UART A0 transmitter model for the host tests of serial.c
+//
+// A thread plays the transmit side of eUSCI_A0 one character time at a
+// time.  Each step, with the interrupt lock held: the character in
+// TXBUF is shifted out and recorded, UCTXIFG rises, a pending DMA
+// channel 0 request moves the next byte of the ring into TXBUF, and the
+// DMA_INT1 and UART handlers of serial.c run if their flags are up.
+
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "msp.h"
+#include "driverlib.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "hostModel.h"
+#include "hostUart.h"
+
+void vUART_Handler( void );
+void vSerialTxDMA_Handler( void );
+
+EUSCI_A_Type Host_UartA0;
+uint8_t Host_UartOut[HOST_UART_OUT];
+volatile uint32_t Host_UartOutN;
+volatile int Host_UartHold;
+
+static volatile int Running;
+static uint32_t CharUs;
+
+// cs.c
+uint32_t CS_getSMCLK(void){ return 48000000; }
+
+// uart.c
+bool UART_initModule(uintptr_t moduleInstance, const eUSCI_UART_Config *config){
+  EUSCI_A_Type *u = (EUSCI_A_Type *)moduleInstance;
+  u->BRW = config->clockPrescalar;
+  u->IE = 0;
+  u->IFG = EUSCI_A_IFG_TXIFG;
+  u->TXBUF = HOST_TXBUF_EMPTY;
+  return true;
+}
+void UART_enableModule(uintptr_t moduleInstance){}
+void UART_enableInterrupt(uintptr_t moduleInstance, uint_fast8_t mask){
+  ((EUSCI_A_Type *)moduleInstance)->IE |= mask;
+}
+void UART_disableInterrupt(uintptr_t moduleInstance, uint_fast8_t mask){
+  ((EUSCI_A_Type *)moduleInstance)->IE &= ~mask;
+}
+void UART_clearInterruptFlag(uintptr_t moduleInstance, uint_fast8_t mask){
+  ((EUSCI_A_Type *)moduleInstance)->IFG &= ~mask;
+}
+uint_fast8_t UART_getEnabledInterruptStatus(uintptr_t moduleInstance){
+  EUSCI_A_Type *u = (EUSCI_A_Type *)moduleInstance;
+  return u->IFG & u->IE;
+}
+uint_fast8_t UART_queryStatusFlags(uintptr_t moduleInstance, uint_fast8_t mask){
+  return 0;                               // the shift register is never busy here
+}
+uintptr_t UART_getTransmitBufferAddressForDMA(uintptr_t moduleInstance){
+  return (uintptr_t)&((EUSCI_A_Type *)moduleInstance)->TXBUF;
+}
+
+void Host_UartStep(void){
+  EUSCI_A_Type *u = &Host_UartA0;
+  Host_EnterCritical();
+  if(!Host_UartHold){
+    if(u->TXBUF != HOST_TXBUF_EMPTY){
+      if(Host_UartOutN < HOST_UART_OUT) Host_UartOut[Host_UartOutN] = (uint8_t)u->TXBUF;
+      Host_UartOutN++;
+      u->TXBUF = HOST_TXBUF_EMPTY;
+    }
+    u->IFG |= EUSCI_A_IFG_TXIFG;
+    if(Host_DmaRequest(0)){
+      u->TXBUF &= 0xFF;                   // the DMA wrote the low byte
+      u->IFG &= ~EUSCI_A_IFG_TXIFG;
+    }
+    if((Host_DmaDone&1) && (Host_IntEnabled&((uint64_t)1<<INT_DMA_INT1))){
+      vSerialTxDMA_Handler();
+    }
+    if(u->IFG&u->IE&EUSCI_A_IFG_TXIFG){
+      vUART_Handler();
+    }
+    // a write to TXBUF clears UCTXIFG
+    if(u->TXBUF != HOST_TXBUF_EMPTY) u->IFG &= ~EUSCI_A_IFG_TXIFG;
+  }
+  Host_ExitCritical();
+}
+
+static void *Host_UartThread(void *arg){
+  while(Running){
+    Host_UartStep();
+    if(CharUs) usleep(CharUs);
+  }
+  return NULL;
+}
+
+static pthread_t Thread;
+
+void Host_UartStart(uint32_t charUs){
+  Host_UartA0.TXBUF = HOST_TXBUF_EMPTY;
+  Host_UartA0.IFG = EUSCI_A_IFG_TXIFG;
+  Host_UartOutN = 0;
+  Host_UartHold = 0;
+  CharUs = charUs;
+  Running = 1;
+  pthread_create(&Thread, NULL, Host_UartThread, NULL);
+}
+
+void Host_UartWaitIdle(void){
+  while(Host_UartA0.TXBUF != HOST_TXBUF_EMPTY){
+    usleep(100);
+  }
+}
+
+void Host_UartStop(void){
+  Running = 0;
+  pthread_join(Thread, NULL);
+}
@@ -0,0 +1,57 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        hostUart.h
+// Function:    header file of hostUart.c
+
+#ifndef HOSTUART_H_
+#define HOSTUART_H_
+
+#include <stdint.h>
+
+// Everything the UART has sent since Host_UartStart
+#define HOST_UART_OUT   (1<<20)
+extern uint8_t Host_UartOut[HOST_UART_OUT];
+extern volatile uint32_t Host_UartOutN;
+
+// Set to 1 to stall the transmitter, e.g. to make a flush time out
+extern volatile int Host_UartHold;
+
+/**
+ * Start the transmitter thread
+ *
+ * @param  charUs is the real time of one character in us, 0 runs flat out
+ * @return none
+ * @brief  Start the UART model
+ */
+void Host_UartStart(uint32_t charUs);
+
+/**
+ * Stop the transmitter thread
+ *
+ * @param  none
+ * @return none
+ * @brief  Stop the UART model
+ */
+void Host_UartStop(void);
+
+/**
+ * Wait for the last character handed to the UART to go out
+ *
+ * @param  none
+ * @return none
+ * @note   xSerialTxFlush returns once the ring is empty, when the last
+ *         character may still be in TXBUF
+ * @brief  Wait until TXBUF is empty
+ */
+void Host_UartWaitIdle(void);
+
+/**
+ * One character time of the transmitter, as run by the thread
+ *
+ * @param  none
+ * @return none
+ * @brief  Step the UART model
+ */
+void Host_UartStep(void);
+
+#endif
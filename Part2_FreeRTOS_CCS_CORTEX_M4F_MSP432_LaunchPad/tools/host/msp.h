@@ -0,0 +1,82 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        msp.h
+// Function:    Host register model of the MSP432 peripherals used by the demo
+//
+// Stands in for the device msp.h when modules of ../../ are built with the
+// host compiler for the tests in ../.  Each peripheral is a plain struct
+// in RAM (hostModel.c) with the register names of the device header, so a
+// module writes it exactly as it writes the hardware and a test reads it
+// back.  Nothing happens on its own: the tests run the timers and the DMA.
+
+#ifndef HOST_MSP_H_
+#define HOST_MSP_H_
+
+#include <stdint.h>
+
+// Read-only registers stay writable here so a test can drive them
+#define __I     volatile
+#define __O     volatile
+#define __IO    volatile
+
+// Digital I/O port, 8-bit view as in DIO_PORT_Odd/Even_Interruptable_Type
+typedef struct {
+  __I  uint8_t  IN;
+  __IO uint8_t  OUT;
+  __IO uint8_t  DIR;
+  __IO uint8_t  REN;
+  __IO uint8_t  DS;
+  __IO uint8_t  SEL0;
+  __IO uint8_t  SEL1;
+  __IO uint8_t  SELC;
+  __IO uint8_t  IES;
+  __IO uint8_t  IE;
+  __IO uint8_t  IFG;
+  __I  uint16_t IV;
+} DIO_PORT_Interruptable_Type;
+
+typedef struct {
+  __IO uint16_t CTL;
+  __IO uint16_t CCTL[7];
+  __IO uint16_t R;
+  __IO uint16_t CCR[7];
+  __IO uint16_t EX0;
+  __I  uint16_t IV;
+} Timer_A_Type;
+
+// eUSCI_A.  TXBUF is wider than on the device so the UART model in
+// hostUart.c can tell an empty TXBUF (HOST_TXBUF_EMPTY) from any byte
+typedef struct {
+  __IO uint16_t CTLW0;
+  __IO uint16_t BRW;
+  __IO uint16_t MCTLW;
+  __IO uint16_t STATW;
+  __I  uint16_t RXBUF;
+  __IO uint32_t TXBUF;
+  __IO uint16_t IE;
+  __IO uint16_t IFG;
+  __I  uint16_t IV;
+} EUSCI_A_Type;
+#define HOST_TXBUF_EMPTY    0xFFFFFFFFUL
+
+#define EUSCI_A_IFG_RXIFG   ((uint16_t)0x0001)
+#define EUSCI_A_IFG_TXIFG   ((uint16_t)0x0002)
+#define EUSCI_A_IE_RXIE     ((uint16_t)0x0001)
+#define EUSCI_A_IE_TXIE     ((uint16_t)0x0002)
+#define EUSCI_A_STATW_BUSY  ((uint16_t)0x0001)
+#define EUSCI_A_STATW_OE    ((uint16_t)0x0020)
+
+extern DIO_PORT_Interruptable_Type Host_P[11];
+extern Timer_A_Type Host_TimerA[4];
+extern EUSCI_A_Type Host_UartA0;
+
+#define P1          (&Host_P[1])
+#define P2          (&Host_P[2])
+#define P3          (&Host_P[3])
+#define TIMER_A0    (&Host_TimerA[0])
+#define TIMER_A1    (&Host_TimerA[1])
+#define TIMER_A2    (&Host_TimerA[2])
+#define TIMER_A3    (&Host_TimerA[3])
+#define EUSCI_A0_BASE ((uintptr_t)&Host_UartA0)
+
+#endif
@@ -0,0 +1,4 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        queue.h
+// Function:    Empty, the host tests use no queues
@@ -0,0 +1,19 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        serial.h
+// Function:    The demo serial.h interface of FreeRTOS Demo/Common/include
+
+#ifndef HOST_SERIAL_COMMS_H_
+#define HOST_SERIAL_COMMS_H_
+
+#include "FreeRTOS.h"
+
+typedef void * xComPortHandle;
+
+xComPortHandle xSerialPortInitMinimal( unsigned long ulWantedBaud, unsigned long uxQueueLength );
+signed portBASE_TYPE xSerialGetChar( xComPortHandle pxPort, signed char *pcRxedChar, TickType_t xBlockTime );
+signed portBASE_TYPE xSerialPutChar( xComPortHandle pxPort, signed char cOutChar, TickType_t xBlockTime );
+void vSerialPutString( xComPortHandle pxPort, const signed char * const pcString, unsigned short usStringLength );
+void vSerialClose( xComPortHandle xPort );
+
+#endif
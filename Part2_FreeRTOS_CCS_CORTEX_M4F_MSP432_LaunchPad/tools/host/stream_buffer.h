@@ -0,0 +1,22 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        stream_buffer.h
+// Function:    Stream buffer calls of FreeRTOS, receive side of serial.c
+//
+// The host tests only transmit: nothing is ever received.
+
+#ifndef HOST_STREAM_BUFFER_H_
+#define HOST_STREAM_BUFFER_H_
+
+#include "FreeRTOS.h"
+
+typedef struct Host_StreamBuffer *StreamBufferHandle_t;
+
+StreamBufferHandle_t xStreamBufferCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes );
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData,
+        size_t xBufferLengthBytes, TickType_t xTicksToWait );
+size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvData,
+        size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken );
+BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevel );
+
+#endif
@@ -0,0 +1,38 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        task.h
+// Function:    The task calls of FreeRTOS used by the demo, see hostRtos.c
+
+#ifndef HOST_TASK_H_
+#define HOST_TASK_H_
+
+#include "FreeRTOS.h"
+
+typedef struct Host_Task *TaskHandle_t;
+typedef void (*TaskFunction_t)( void * );
+
+typedef struct {
+  BaseType_t xOverflowCount;
+  TickType_t xTimeOnEntering;
+} TimeOut_t;
+
+BaseType_t xTaskCreate( TaskFunction_t pxTaskCode, const char * const pcName,
+        const uint16_t usStackDepth, void * const pvParameters,
+        UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask );
+TaskHandle_t xTaskGetCurrentTaskHandle( void );
+TickType_t xTaskGetTickCount( void );
+void vTaskDelay( const TickType_t xTicksToDelay );
+void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut );
+BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut, TickType_t * const pxTicksToWait );
+uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait );
+BaseType_t xTaskNotifyGive( TaskHandle_t xTaskToNotify );
+void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken );
+
+// The critical sections, and the interrupt handlers run by the models,
+// hold one recursive lock, so they exclude each other as on one core
+void Host_EnterCritical( void );
+void Host_ExitCritical( void );
+#define taskENTER_CRITICAL()    Host_EnterCritical()
+#define taskEXIT_CRITICAL()     Host_ExitCritical()
+
+#endif
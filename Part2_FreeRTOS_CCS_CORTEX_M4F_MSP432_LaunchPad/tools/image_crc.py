@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+# Author:      Mohd A. Zainol
+# Date:        16 Oct 2026
+# File:        image_crc.py
+# Function:    Post-link step that fills in the image CRC trailer of bootCheck.c
+#
+# Usage: python3 image_crc.py Debug/RTOSDemo.out [Debug/RTOSDemo.bin]
+#
+# Run after every link, before loading the program; the Debug and
+# Release configurations in .cproject run it after tiobj2bin.  The .out is
+# patched in place, and must have bootCheck.c linked in: an older build
+# such as the Debug/RTOSDemo.out in the tree has no .imageTrailer and is
+# refused.  If the .bin made by tiobj2bin is given, its image and
+# trailer bytes are rewritten too so both files load the same flash.
+#
+# The image is everything loaded into MAIN flash below the trailer, gaps
+# filled with 0xFF like erased flash.  One CRC-32 (as zlib) is stored for
+# every 4kB sector, then a CRC-32 of the trailer itself, in the layout of
+# bootTrailer_t in bootCheck.h.
+
+import struct
+import sys
+import zlib
+
+SECTOR = 4096
+TRAILER_ADDR = 0x3F000
+MAX_SECTORS = TRAILER_ADDR // SECTOR
+UNSIGNED = 0x554E5347
+SIGNED = 0x43524332
+PT_LOAD = 1
+
+
+def read_elf(data):
+    """Return (flash image bytes, file offset of .imageTrailer)."""
+    if data[:4] != b'\x7fELF' or data[4] != 1 or data[5] != 1:
+        sys.exit('not a 32-bit little-endian ELF file')
+    (phoff, shoff, _flags, _ehsize, phentsize, phnum,
+     shentsize, shnum, shstrndx) = struct.unpack_from('<IIIHHHHHH', data, 28)
+
+    image = bytearray(b'\xff' * TRAILER_ADDR)
+    end = 0
+    for i in range(phnum):
+        (ptype, offset, _vaddr, paddr, filesz, _memsz, _flags,
+         _align) = struct.unpack_from('<8I', data, phoff + i * phentsize)
+        if ptype != PT_LOAD or filesz == 0 or paddr >= TRAILER_ADDR:
+            continue
+        if paddr + filesz > TRAILER_ADDR:
+            sys.exit('image overlaps the trailer at 0x%X' % TRAILER_ADDR)
+        image[paddr:paddr + filesz] = data[offset:offset + filesz]
+        end = max(end, paddr + filesz)
+    end = (end + 3) & ~3
+
+    def section(i):
+        return struct.unpack_from('<10I', data, shoff + i * shentsize)
+    names = section(shstrndx)[4]
+    for i in range(shnum):
+        name, _type, _flags, addr, offset, size = section(i)[:6]
+        n = data[names + name:data.index(b'\0', names + name)].decode()
+        if n == '.imageTrailer':
+            if addr != TRAILER_ADDR or size < 4 * (4 + MAX_SECTORS):
+                sys.exit('.imageTrailer is not where bootCheck.h expects it')
+            return bytes(image[:end]), offset
+    sys.exit('no .imageTrailer section, is bootCheck.c linked in?')
+
+
+def trailer(image):
+    sectors = (len(image) + SECTOR - 1) // SECTOR
+    crcs = [zlib.crc32(image[s * SECTOR:(s + 1) * SECTOR]) for s in range(sectors)]
+    crcs += [0] * (MAX_SECTORS - sectors)
+    body = struct.pack('<3I%dI' % MAX_SECTORS, SIGNED, len(image), sectors, *crcs)
+    return body + struct.pack('<I', zlib.crc32(body))
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        sys.exit('usage: image_crc.py program.out [program.bin]')
+    with open(sys.argv[1], 'rb') as f:
+        elf = bytearray(f.read())
+    image, offset = read_elf(elf)
+    magic = struct.unpack_from('<I', elf, offset)[0]
+    if magic not in (UNSIGNED, SIGNED):
+        sys.exit('.imageTrailer does not hold a bootTrailer_t')
+    t = trailer(image)
+    elf[offset:offset + len(t)] = t
+    with open(sys.argv[1], 'wb') as f:
+        f.write(elf)
+
+    if len(sys.argv) == 3:
+        with open(sys.argv[2], 'rb') as f:
+            binary = bytearray(f.read())
+        if len(binary) < TRAILER_ADDR + len(t):
+            sys.exit('%s does not reach the trailer' % sys.argv[2])
+        binary[:len(image)] = image
+        binary[TRAILER_ADDR:TRAILER_ADDR + len(t)] = t
+        with open(sys.argv[2], 'wb') as f:
+            f.write(binary)
+
+    print('image 0x%X bytes, %d sectors, trailer CRC 0x%08X'
+          % (len(image), (len(image) + SECTOR - 1) // SECTOR,
+             struct.unpack_from('<I', t, len(t) - 4)[0]))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+# Author:      Mohd A. Zainol
+# Date:        16 Oct 2026
+# File:        song_compile.py
+# Function:    Compile a text score into the note-stream format of noteStream.h
+#
+# Usage: python3 song_compile.py score.txt name > name.c
+#
+# Score syntax, tokens separated by spaces or new lines:
+#   C4q  D#5e  Bb3h.   note, accidental, octave 0-7, duration, optional dot
+#                      durations: w whole, h half, q quarter, e eighth,
+#                      s sixteenth; dotted h, q and e
+#   Rq   Rh.           rest
+#   T140               tempo in quarter notes per minute, 4 to 4095
+#   [ ... ]x3          play the part between the brackets 3 times
+#   |                  bar line, ignored
+#   // text            comment to the end of the line
+
+import re
+import sys
+
+NOTES = {'C': 0, 'D': 2, 'E': 4, 'F': 5, 'G': 7, 'A': 9, 'B': 11}
+NAMES = ['NOTE_C', 'NOTE_CS', 'NOTE_D', 'NOTE_DS', 'NOTE_E', 'NOTE_F',
+         'NOTE_FS', 'NOTE_G', 'NOTE_GS', 'NOTE_A', 'NOTE_AS', 'NOTE_B']
+DURATIONS = {'w': 'DUR_WHOLE', 'h': 'DUR_HALF', 'q': 'DUR_QUARTER',
+             'e': 'DUR_EIGHTH', 's': 'DUR_SIXTEENTH',
+             'h.': 'DUR_DOTTED_HALF', 'q.': 'DUR_DOTTED_QUARTER',
+             'e.': 'DUR_DOTTED_EIGHTH'}
+
+NOTE_RE = re.compile(r'^([A-G])([#b]?)([0-7])([whqes]\.?)$')
+REST_RE = re.compile(r'^R([whqes]\.?)$')
+TEMPO_RE = re.compile(r'^T([0-9]+)$')
+REPEAT_RE = re.compile(r'^\]x([0-9]+)$')
+
+SONG_MIN_BPM = 4                        # as in noteStream.h
+
+
+def duration(code, token):
+    if code not in DURATIONS:
+        sys.exit('bad duration in %s' % token)
+    return DURATIONS[code]
+
+
+def compile_score(text):
+    out = []
+    start = None                        # index of the open bracket
+    for line in text.splitlines():
+        for tok in line.split('//')[0].split():
+            if tok == '|':
+                continue
+            m = NOTE_RE.match(tok)
+            if m:
+                n = NOTES[m.group(1)] + {'': 0, '#': 1, 'b': -1}[m.group(2)]
+                octave = int(m.group(3))
+                if n < 0:
+                    n, octave = 11, octave - 1
+                elif n > 11:
+                    n, octave = 0, octave + 1
+                if not 0 <= octave <= 7:
+                    sys.exit('octave out of range in %s' % tok)
+                out.append('SONG_NOTE(%s,%d,%s)' % (NAMES[n], octave, duration(m.group(4), tok)))
+                continue
+            m = REST_RE.match(tok)
+            if m:
+                out.append('SONG_REST(%s)' % duration(m.group(1), tok))
+                continue
+            m = TEMPO_RE.match(tok)
+            if m:
+                bpm = int(m.group(1))
+                # below SONG_MIN_BPM a whole note overflows the 16-bit ms
+                if not SONG_MIN_BPM <= bpm <= 4095:
+                    sys.exit('tempo out of range in %s, %d to 4095' % (tok, SONG_MIN_BPM))
+                out.append('SONG_TEMPO(%d)' % bpm)
+                continue
+            if tok == '[':
+                if start is not None:
+                    sys.exit('repeats cannot be nested')
+                start = len(out)
+                continue
+            m = REPEAT_RE.match(tok)
+            if m:
+                if start is None:
+                    sys.exit('] without [')
+                times, back = int(m.group(1)), len(out) - start
+                if not 2 <= times <= 64 or not 1 <= back <= 63:
+                    sys.exit('repeat of %d tokens %d times is out of range' % (back, times))
+                out.append('SONG_REPEAT(%d,%d)' % (times - 1, back))
+                start = None
+                continue
+            sys.exit('cannot read %s' % tok)
+    if start is not None:
+        sys.exit('[ without ]')
+    out.append('SONG_END')
+    return out
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit('usage: song_compile.py score.txt name > name.c')
+    with open(sys.argv[1]) as f:
+        tokens = compile_score(f.read())
+    print('// Generated by tools/song_compile.py from %s, %d bytes' % (sys.argv[1], 2*len(tokens)))
+    print('#include <stdint.h>')
+    print('#include "noteStream.h"')
+    print()
+    print('const uint16_t %s[%d] = {' % (sys.argv[2], len(tokens)))
+    for i in range(0, len(tokens), 4):
+        print('    ' + ', '.join(tokens[i:i+4]) + ',')
+    print('};')
+
+
+if __name__ == '__main__':
+    main()
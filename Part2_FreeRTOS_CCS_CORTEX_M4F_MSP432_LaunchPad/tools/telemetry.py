@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+# Author:      Mohd A. Zainol
+# Date:        16 Oct 2026
+# File:        telemetry.py
+# Function:    Host decoder for the binary telemetry stream of telemetry.c
+#
+# Usage as a program:  python3 telemetry.py capture.bin      print every record
+#                      python3 telemetry.py /dev/ttyACM0     needs pyserial
+#
+# Usage as a library:
+#   import telemetry
+#   dec = telemetry.Decoder()
+#   for rec in dec.feed(data):      # data is any chunk of bytes
+#       print(rec.seq, rec.name, rec.fields)
+#   dec.frames, dec.bad_crc, dec.bad_frame, dec.lost   # counters
+
+import struct
+import sys
+import zlib
+from collections import namedtuple
+
+# channel: (name, struct format, field names), must match telemetry.h
+SCHEMAS = {
+    0: ('pose', '<iiHH', ('x', 'y', 'theta', 'reserved')),
+    1: ('motor', '<hh', ('left', 'right')),
+    2: ('bump', '<B3x', ('bump',)),
+    3: ('stats', '<IIHH', ('uptime', 'freeHeap', 'tasks', 'dropped')),
+}
+_STRUCTS = {ch: (name, struct.Struct(fmt), fields)
+            for ch, (name, fmt, fields) in SCHEMAS.items()}
+
+Record = namedtuple('Record', 'seq channel name fields')
+
+HEADER = struct.Struct('<HBB')
+MAX_FRAME = 256
+
+
+def cobs_decode(block):
+    """Decode one COBS block, without its 0x00 delimiter. None if invalid."""
+    out = bytearray()
+    i = 0
+    n = len(block)
+    while i < n:
+        code = block[i]
+        end = i + code
+        if code == 0 or end > n:
+            return None
+        out += block[i + 1:end]
+        i = end
+        if code != 0xFF and i < n:
+            out.append(0)
+    return bytes(out)
+
+
+def parse_frame(frame):
+    """Check and unpack one decoded frame. Returns (Record, error)."""
+    if len(frame) < HEADER.size + 4:
+        return None, 'short'
+    body, crc = frame[:-4], struct.unpack_from('<I', frame, len(frame) - 4)[0]
+    if zlib.crc32(body) != crc:
+        return None, 'crc'
+    seq, channel, length = HEADER.unpack_from(body)
+    payload = body[HEADER.size:]
+    if len(payload) != length:
+        return None, 'length'
+    name, st, names = _STRUCTS.get(channel, ('ch%d' % channel, None, None))
+    if st is None or st.size != length:
+        return Record(seq, channel, name, payload), None
+    return Record(seq, channel, name, dict(zip(names, st.unpack(payload)))), None
+
+
+class Decoder:
+    """Incremental stream decoder, resynchronises on every 0x00."""
+
+    def __init__(self):
+        self._buf = bytearray()
+        self._seq = None
+        self.frames = 0
+        self.bad_crc = 0
+        self.bad_frame = 0
+        self.lost = 0           # frames missing from the sequence numbers
+
+    def feed(self, data):
+        self._buf += data
+        records = []
+        start = 0
+        while True:
+            end = self._buf.find(0, start)
+            if end < 0:
+                break
+            block = bytes(self._buf[start:end])
+            start = end + 1
+            if not block:
+                continue
+            if len(block) > MAX_FRAME:
+                self.bad_frame += 1
+                continue
+            frame = cobs_decode(block)
+            if frame is None:
+                self.bad_frame += 1
+                continue
+            rec, err = parse_frame(frame)
+            if err == 'crc':
+                self.bad_crc += 1
+                continue
+            if err:
+                self.bad_frame += 1
+                continue
+            if self._seq is not None:
+                self.lost += (rec.seq - self._seq - 1) & 0xFFFF
+            self._seq = rec.seq
+            self.frames += 1
+            records.append(rec)
+        del self._buf[:start]
+        if len(self._buf) > MAX_FRAME:      # no delimiter in sight, text or noise
+            self.bad_frame += 1
+            self._buf.clear()
+        return records
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit('usage: telemetry.py capture.bin|/dev/ttyXXX')
+    dec = Decoder()
+    if sys.argv[1].startswith('/dev/'):
+        import serial
+        src = serial.Serial(sys.argv[1], 19200, timeout=0.1)
+        read = lambda: src.read(256)
+    else:
+        src = open(sys.argv[1], 'rb')
+        read = lambda: src.read(65536)
+    try:
+        while True:
+            data = read()
+            if not data and not sys.argv[1].startswith('/dev/'):
+                break
+            for rec in dec.feed(data):
+                print(rec.seq, rec.name, rec.fields)
+    except KeyboardInterrupt:
+        pass
+    print('frames %d, bad crc %d, bad frames %d, lost %d'
+          % (dec.frames, dec.bad_crc, dec.bad_frame, dec.lost), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
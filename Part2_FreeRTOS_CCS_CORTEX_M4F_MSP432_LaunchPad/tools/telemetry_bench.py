@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+# Author:      Mohd A. Zainol
+# Date:        16 Oct 2026
+# File:        telemetry_bench.py
+# Function:    Decoding throughput of tools/telemetry.py on captured streams
+#
+# Usage: python3 telemetry_bench.py capture.bin [capture2.bin ...]
+#        python3 telemetry_bench.py --synthetic 100000
+#
+# Each file is fed to the decoder in 4 KB chunks, as it would arrive from
+# a serial port, and the time is reported per file.  --synthetic builds a
+# stream of N frames of every channel first, so the decoder can be timed
+# without a robot.
+
+import os
+import struct
+import sys
+import time
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import telemetry  # noqa: E402
+
+CHUNK = 4096
+
+
+def cobs_encode(data):
+    out = bytearray([0])
+    code = 0
+    for b in data:
+        if b == 0:
+            out[code] = len(out) - code
+            code = len(out)
+            out.append(0)
+        else:
+            out.append(b)
+            if len(out) - code == 0xFF:
+                out[code] = 0xFF
+                code = len(out)
+                out.append(0)
+    out[code] = len(out) - code
+    out.append(0)
+    return bytes(out)
+
+
+def synthetic(n):
+    """n frames of each channel, encoded like telemetry.c does."""
+    out = bytearray()
+    seq = 0
+    payloads = [
+        struct.pack('<iiHH', 123 << 16, -45 << 16, 16384, 0),
+        struct.pack('<hh', 7500, -7500),
+        struct.pack('<B3x', 0x21),
+        struct.pack('<IIHH', 60000, 31000, 9, 0),
+    ]
+    for i in range(n):
+        for ch, p in enumerate(payloads):
+            body = struct.pack('<HBB', seq & 0xFFFF, ch, len(p)) + p
+            out += cobs_encode(body + struct.pack('<I', zlib.crc32(body)))
+            seq += 1
+    return bytes(out)
+
+
+def bench(name, data):
+    dec = telemetry.Decoder()
+    t0 = time.perf_counter()
+    for i in range(0, len(data), CHUNK):
+        dec.feed(data[i:i + CHUNK])
+    dt = time.perf_counter() - t0
+    print('%s: %d bytes, %d frames in %.3f s, %.2f MB/s, %.0f frames/s'
+          ' (bad crc %d, bad frames %d, lost %d)'
+          % (name, len(data), dec.frames, dt, len(data) / dt / 1e6,
+             dec.frames / dt, dec.bad_crc, dec.bad_frame, dec.lost))
+
+
+def main():
+    if len(sys.argv) == 3 and sys.argv[1] == '--synthetic':
+        bench('synthetic', synthetic(int(sys.argv[2])))
+        return
+    if len(sys.argv) < 2:
+        sys.exit('usage: telemetry_bench.py capture.bin ... | --synthetic N')
+    for path in sys.argv[1:]:
+        with open(path, 'rb') as f:
+            bench(path, f.read())
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,82 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        test_crc.c
+// Function:    crcSoft.c against zlib and a bit at a time reference
+//
+// The slice-by-8 loop and the byte loop after it are checked against
+// zlib's crc32 for every length up to a few blocks, at every alignment
+// of the start, and when the data is split over several calls.  The
+// CRC-16 is checked against the polynomial worked one bit at a time.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <zlib.h>
+#include "hostModel.h"
+#include "crcSoft.h"
+
+#define DATA    4096
+
+static uint8_t Data[DATA + 8];
+
+static uint16_t Crc16Bits(uint16_t crc, const uint8_t *p, uint32_t len){
+  int i;
+  while(len--){
+    crc ^= (uint16_t)(*p++ << 8);
+    for(i = 0; i < 8; i++){
+      crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+static void test_check_values(void){
+  CHECK(crcSoft_crc32(0, "123456789", 9) == 0xCBF43926);
+  CHECK(crcSoft_crc16(0xFFFF, "123456789", 9) == 0x29B1);
+  CHECK(crcSoft_crc32(0, Data, 0) == 0);
+}
+
+static void test_crc32_lengths(void){
+  uint32_t len, align;
+  for(align = 0; align < 8; align++){
+    for(len = 0; len <= 300; len++){
+      CHECK(crcSoft_crc32(0, &Data[align], len) ==
+            (uint32_t)crc32(0, &Data[align], len));
+    }
+  }
+  CHECK(crcSoft_crc32(0, Data, DATA) == (uint32_t)crc32(0, Data, DATA));
+}
+
+// Continuing from a previous result gives the CRC of the whole
+static void test_crc32_split(void){
+  uint32_t i, a, b, crc;
+  uint32_t whole = (uint32_t)crc32(0, Data, DATA);
+  for(i = 0; i < 1000; i++){
+    a = (uint32_t)rand()%DATA;
+    b = a + (uint32_t)rand()%(DATA - a + 1);
+    crc = crcSoft_crc32(0, Data, a);
+    crc = crcSoft_crc32(crc, &Data[a], b - a);
+    crc = crcSoft_crc32(crc, &Data[b], DATA - b);
+    CHECK(crc == whole);
+  }
+}
+
+static void test_crc16(void){
+  uint32_t len, a;
+  for(len = 0; len <= 300; len++){
+    CHECK(crcSoft_crc16(0xFFFF, Data, len) == Crc16Bits(0xFFFF, Data, len));
+  }
+  a = 1234;
+  CHECK(crcSoft_crc16(crcSoft_crc16(0xFFFF, Data, a), &Data[a], DATA - a) ==
+        Crc16Bits(0xFFFF, Data, DATA));
+}
+
+int main(void){
+  uint32_t i;
+  srand(1);
+  for(i = 0; i < sizeof(Data); i++) Data[i] = (uint8_t)rand();
+  test_check_values();
+  test_crc32_lengths();
+  test_crc32_split();
+  test_crc16();
+  return Host_Result("test_crc");
+}
@@ -0,0 +1,186 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        test_kv.c
+// Function:    kvStore.c on the NOR flash model, with power failures
+//
+// Usage: build/test_kv [flash file]      default build/kv_flash.bin
+//
+// kvStore.c runs unchanged on hostFlash.c, which keeps the store's
+// sectors in a file.  A fixed workload of sets and deletes, long enough
+// to go round the sectors several times, is run once for every flash
+// call in it with the power failing during that call.  After each
+// failure the store is opened again, sometimes failing once more during
+// the recovery.  Every key must then hold its last value, except the
+// key being written when the power failed, which may hold the value
+// before or after.  The store must then keep working.
+
+#include <stdint.h>
+#include <string.h>
+#include <setjmp.h>
+#include "hostModel.h"
+#include "hostFlash.h"
+#include "kvStore.h"
+
+#define KEYS        20
+#define STEPS       600
+#define AFTER       150         // steps after a failure, more than a sector
+#define KEY(k)      ((uint16_t)(0x100 + 3*(k)))
+
+typedef struct {
+  uint32_t len;             // 0 if the key is not in the store
+  uint8_t  v[KV_MAX_VALUE];
+} Value_t;
+
+static Value_t Want[KEYS];
+static volatile int32_t InStep;     // workload step being run, -1 none
+static Value_t Before, After;       // of the key of that step
+static uint32_t InKey;
+
+// Step i of the workload, the same every run: three steps in ten delete
+// the key, so some keys stay deleted across a compaction, the others set
+// a value of 1 to KV_MAX_VALUE bytes
+static void Step(uint32_t i, uint32_t *k, Value_t *v){
+  uint32_t r = (i + 1)*2654435761u, j;
+  r ^= r >> 13;
+  *k = r%KEYS;
+  v->len = ((r >> 8)%10 < 3) ? 0 : 1 + (r >> 12)%KV_MAX_VALUE;
+  for(j = 0; j < v->len; j++){
+    v->v[j] = (uint8_t)(i*31 + j*7 + *k);
+  }
+}
+
+static void Workload(uint32_t from, uint32_t to){
+  uint32_t i;
+  Value_t v;
+  for(i = from; i < to; i++){
+    Step(i, &InKey, &v);
+    Before = Want[InKey];
+    After = v;
+    InStep = (int32_t)i;
+    if(v.len){
+      CHECK(kv_set(KEY(InKey), v.v, v.len) == 1);
+    }else{
+      CHECK(kv_delete(KEY(InKey)) == 1);
+    }
+    Want[InKey] = v;
+    InStep = -1;
+  }
+}
+
+static int Same(const Value_t *v, const uint8_t *buf, uint32_t len){
+  return (v->len == len) && (memcmp(v->v, buf, len) == 0);
+}
+
+// Every key holds its last value, the key of an unfinished step the one
+// before or after
+static void Verify(void){
+  uint8_t buf[KV_MAX_VALUE];
+  uint32_t k, len;
+  for(k = 0; k < KEYS; k++){
+    len = kv_get(KEY(k), buf, sizeof(buf));
+    if((InStep >= 0) && (k == InKey)){
+      CHECK(Same(&Before, buf, len) || Same(&After, buf, len));
+      if(Same(&After, buf, len)) Want[k] = After;
+    }else{
+      CHECK(Same(&Want[k], buf, len));
+    }
+  }
+  InStep = -1;
+}
+
+static void Fresh(void){
+  Host_FlashErase();
+  Host_FlashOps = 0;
+  Host_FlashReprograms = 0;
+  memset(Want, 0, sizeof(Want));
+  InStep = -1;
+}
+
+static void test_basic(const char *path){
+  uint8_t buf[KV_MAX_VALUE + 1], big[KV_MAX_VALUE + 1];
+  uint32_t ops, k;
+  Fresh();
+  CHECK(kv_init() == 1);
+  CHECK(kv_get(1, buf, sizeof(buf)) == 0);
+  CHECK(kv_set(1, "gain", 4) == 1);
+  CHECK(kv_get(1, buf, sizeof(buf)) == 4 && memcmp(buf, "gain", 4) == 0);
+  CHECK(kv_get(1, buf, 2) == 4);          // cut short, the length is still 4
+  ops = Host_FlashOps;
+  CHECK(kv_set(1, "gain", 4) == 1);       // the same value, no flash call
+  CHECK(Host_FlashOps == ops);
+  memset(big, 0x5A, sizeof(big));
+  CHECK(kv_set(2, big, 0) == 0);
+  CHECK(kv_set(2, big, KV_MAX_VALUE + 1) == 0);
+  CHECK(kv_set(0xFFFF, big, 1) == 0);
+  CHECK(kv_set(2, big, KV_MAX_VALUE) == 1);
+  CHECK(kv_delete(1) == 1);
+  CHECK(kv_get(1, buf, sizeof(buf)) == 0);
+  CHECK(kv_delete(1) == 1);               // not there, nothing to do
+  for(k = 0; k < KV_MAX_KEYS - 1; k++){
+    CHECK(kv_set((uint16_t)(100 + k), &k, sizeof(k)) == 1);
+  }
+  CHECK(kv_set(99, "x", 1) == 0);         // KV_MAX_KEYS already stored
+  // the store is in the file, it is all there after opening it again
+  Host_FlashClose();
+  CHECK(Host_FlashOpen(path) == 1);
+  CHECK(kv_init() == 1);
+  CHECK(kv_get(2, buf, sizeof(buf)) == KV_MAX_VALUE && memcmp(buf, big, KV_MAX_VALUE) == 0);
+  CHECK(kv_get(100 + 7, &k, sizeof(k)) == sizeof(k) && k == 7);
+  CHECK(kv_get(1, buf, sizeof(buf)) == 0);
+  CHECK(Host_FlashReprograms == 0);
+}
+
+// Open the store again after a failure, n picks whether the power fails
+// once more during it.  Then it must work normally.
+static void Recover(uint32_t n){
+  uint32_t from = (InStep >= 0) ? (uint32_t)InStep + 1 : 0;
+  if(setjmp(Host_FlashPowerFail) == 0){
+    Host_FlashCutAt = (n%3 == 0) ? Host_FlashOps + 1 + n%4 : 0;
+    CHECK(kv_init() == 1);
+  }else{
+    CHECK(kv_init() == 1);
+  }
+  Host_FlashCutAt = 0;
+  Verify();
+  Workload(from, from + AFTER);
+  CHECK(kv_init() == 1);
+  Verify();
+  CHECK(Host_FlashReprograms == 0);
+}
+
+static void test_power_fail(void){
+  static volatile uint32_t cut, failures;
+  uint32_t full;
+  Fresh();
+  CHECK(kv_init() == 1);
+  Workload(0, STEPS);
+  Verify();
+  full = Host_FlashOps;
+  CHECK(full > STEPS);                    // compactions happened
+  failures = 0;
+  for(cut = 1; ; cut++){
+    Fresh();
+    Host_FlashCutAt = cut;
+    if(setjmp(Host_FlashPowerFail) == 0){
+      CHECK(kv_init() == 1);
+      Workload(0, STEPS);
+      Host_FlashCutAt = 0;
+      break;                              // no flash call left to fail in
+    }
+    failures++;
+    Recover(cut);
+  }
+  CHECK(failures == full);
+}
+
+int main(int argc, char **argv){
+  const char *path = (argc > 1) ? argv[1] : "build/kv_flash.bin";
+  if(Host_FlashOpen(path) == 0){
+    printf("test_kv: cannot open %s\n", path);
+    return 1;
+  }
+  test_basic(path);
+  test_power_fail();
+  Host_FlashClose();
+  return Host_Result("test_kv");
+}
@@ -0,0 +1,140 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        test_serial.c
+// Function:    Transmit ring and flush of Full_Demo/serial.c on the host
+//
+// serial.c runs unchanged on the FreeRTOS model (tasks are threads) with
+// the UART model of hostUart.c sending one character every few us.
+// Several tasks write and flush at the same time, more of them than the
+// flush has slots for, and a flush that times out must not take the
+// place of another task still waiting.
+
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "serial.h"
+#include "serialExt.h"
+#include "hostModel.h"
+#include "hostUart.h"
+
+#define WRITERS     6           // more than serTX_MAX_WAITERS
+#define ROUNDS      10
+#define MESSAGE     300
+
+static volatile uint32_t Done;
+static volatile uint32_t Failed;
+static size_t Empty;            // xSerialTxSpace of an empty ring
+
+static void Clear(void){
+  taskENTER_CRITICAL();
+  Host_UartOutN = 0;
+  taskEXIT_CRITICAL();
+}
+
+// Wait up to ms for *flag to reach n
+static int WaitFor(volatile uint32_t *flag, uint32_t n, uint32_t ms){
+  while((*flag < n) && ms--){
+    usleep(1000);
+  }
+  return *flag >= n;
+}
+
+static void test_write(void){
+  static char Long[2000];
+  uint32_t i;
+  Clear();
+  CHECK(xSerialWrite("hello", 5) == 5);
+  CHECK(xSerialTxFlush(portMAX_DELAY) == pdPASS);
+  Host_UartWaitIdle();
+  CHECK(Host_UartOutN == 5);
+  CHECK(memcmp(Host_UartOut, "hello", 5) == 0);
+  // longer than the ring, vSerialPutString waits for room
+  for(i = 0; i < sizeof(Long); i++) Long[i] = (char)(i*7);
+  Clear();
+  vSerialPutString(0, (const signed char *)Long, sizeof(Long));
+  CHECK(xSerialTxFlush(portMAX_DELAY) == pdPASS);
+  Host_UartWaitIdle();
+  CHECK(Host_UartOutN == sizeof(Long));
+  CHECK(memcmp(Host_UartOut, Long, sizeof(Long)) == 0);
+  CHECK(xSerialTxFlush(0) == pdPASS);      // already empty
+  Empty = xSerialTxSpace();
+  CHECK(Empty >= 256);
+}
+
+// Each writer sends its own letter, the UART must see every one of them
+static void prvWriter(void *pvParameters){
+  char msg[MESSAGE];
+  uint32_t i;
+  memset(msg, 'A' + (int)(intptr_t)pvParameters, sizeof(msg));
+  for(i = 0; i < ROUNDS; i++){
+    vSerialPutString(0, (const signed char *)msg, sizeof(msg));
+    if(xSerialTxFlush(portMAX_DELAY) != pdPASS) Failed++;
+  }
+  taskENTER_CRITICAL();
+  Done++;
+  taskEXIT_CRITICAL();
+  for(;;) vTaskDelay(1000);
+}
+
+static void test_writers(void){
+  uint32_t i, count[WRITERS] = {0};
+  Clear();
+  Done = Failed = 0;
+  for(i = 0; i < WRITERS; i++){
+    xTaskCreate(prvWriter, "W", configMINIMAL_STACK_SIZE, (void *)(intptr_t)i, 1, NULL);
+  }
+  CHECK(WaitFor(&Done, WRITERS, 20000));   // no flush is left waiting
+  CHECK(Failed == 0);
+  CHECK(xSerialTxFlush(pdMS_TO_TICKS(1000)) == pdPASS);
+  Host_UartWaitIdle();
+  CHECK(Host_UartOutN == WRITERS*ROUNDS*MESSAGE);
+  for(i = 0; i < Host_UartOutN && i < HOST_UART_OUT; i++){
+    if(Host_UartOut[i] >= 'A' && Host_UartOut[i] < 'A' + WRITERS){
+      count[Host_UartOut[i] - 'A']++;
+    }
+  }
+  for(i = 0; i < WRITERS; i++){
+    CHECK(count[i] == ROUNDS*MESSAGE);
+  }
+}
+
+static volatile uint32_t Flushed;
+static volatile BaseType_t FlushResult;
+
+static void prvFlusher(void *pvParameters){
+  FlushResult = xSerialTxFlush(portMAX_DELAY);
+  Flushed = 1;
+  for(;;) vTaskDelay(1000);
+}
+
+// A flush that times out must leave the other waiter registered
+static void test_timeout(void){
+  Clear();
+  Flushed = 0;
+  Host_UartHold = 1;                       // the line stalls
+  CHECK(xSerialWrite("0123456789", 10) == 10);
+  CHECK(xSerialTxSpace() == Empty - 10);
+  xTaskCreate(prvFlusher, "F", configMINIMAL_STACK_SIZE, NULL, 1, NULL);
+  usleep(20000);                           // the flusher is waiting
+  CHECK(xSerialTxFlush(pdMS_TO_TICKS(20)) == pdFAIL);
+  CHECK(Flushed == 0);
+  Host_UartHold = 0;
+  CHECK(WaitFor(&Flushed, 1, 2000));
+  CHECK(FlushResult == pdPASS);
+  Host_UartWaitIdle();
+  CHECK(Host_UartOutN == 10);
+}
+
+int main(void){
+  alarm(60);                               // a flush that never returns
+  Host_Reset();
+  xSerialPortInitMinimal(0, 0);
+  Host_UartStart(1);
+  test_write();
+  test_writers();
+  test_timeout();
+  Host_UartStop();
+  return Host_Result("test_serial");
+}
@@ -0,0 +1,170 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        test_serial_log.c
+// Function:    Concurrent producers of Full_Demo/serialLog.c on the host
+//
+// serialLog.c and serial.c run unchanged on the FreeRTOS model (tasks are
+// threads) with the UART model of hostUart.c.  Several producer tasks log
+// numbered records at the same time while a CLI task writes and flushes
+// the same UART, so the drain task has to share the transmit ring and the
+// flush with it.  Every record a producer was told went in must reach the
+// UART whole and in its producer's order, every other one must be counted
+// as dropped, and the drain task must keep going to the end.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "serial.h"
+#include "serialExt.h"
+#include "serialLog.h"
+#include "hostModel.h"
+#include "hostUart.h"
+
+#define PRODUCERS   4
+#define RECORDS     300
+#define CLI_LINES   40
+#define CLI_LINE    100
+
+static volatile uint32_t Done;
+static uint8_t Sent[PRODUCERS][RECORDS];    // 1 if xSerialLogWrite took it
+static volatile uint32_t SentBytes;
+static volatile uint32_t FailedRecords;
+
+// Producer p, record n: "Pnnnnn" then 0 to 39 '-' then '\n', upper case
+// and digits only, so it is told apart from the CLI's 'c'
+static uint32_t Record(char *buf, uint32_t p, uint32_t n){
+  uint32_t len = (uint32_t)sprintf(buf, "%c%05u", 'P' + (int)p, (unsigned)n);
+  uint32_t fill = (n*7 + p)%40;
+  memset(buf + len, '-', fill);
+  buf[len + fill] = '\n';
+  return len + fill + 1;
+}
+
+static void Count(volatile uint32_t *counter, uint32_t n){
+  taskENTER_CRITICAL();
+  *counter += n;
+  taskEXIT_CRITICAL();
+}
+
+static void prvProducer(void *pvParameters){
+  uint32_t p = (uint32_t)(intptr_t)pvParameters, n, len;
+  char buf[64];
+  for(n = 0; n < RECORDS; n++){
+    len = Record(buf, p, n);
+    if(xSerialLogWrite(buf, len) == pdPASS){
+      Sent[p][n] = 1;
+      Count(&SentBytes, len);
+    }else{
+      Count(&FailedRecords, 1);
+    }
+    vTaskDelay(1 + n%3);
+  }
+  Count(&Done, 1);
+  for(;;) vTaskDelay(1000);
+}
+
+// Writes and flushes the UART like the command console does
+static void prvCli(void *pvParameters){
+  char line[CLI_LINE];
+  uint32_t i;
+  memset(line, 'c', sizeof(line));
+  for(i = 0; i < CLI_LINES; i++){
+    vSerialPutString(0, (const signed char *)line, sizeof(line));
+    xSerialTxFlush(portMAX_DELAY);
+  }
+  Count(&Done, 1);
+  for(;;) vTaskDelay(1000);
+}
+
+// Wait up to ms for *flag to reach n
+static int WaitFor(volatile uint32_t *flag, uint32_t n, uint32_t ms){
+  while((*flag < n) && ms--){
+    usleep(1000);
+  }
+  return *flag >= n;
+}
+
+static void test_limits(void){
+  static char Big[serLOG_MAX_RECORD + 1];
+  uint32_t records, bytes;
+  CHECK(xSerialLogWrite(Big, 0) == pdFAIL);
+  CHECK(xSerialLogWrite(Big, sizeof(Big)) == pdFAIL);
+  vSerialLogGetDropped(&records, &bytes);
+  CHECK(records == 2);
+  CHECK(bytes == sizeof(Big));
+}
+
+static void test_producers(void){
+  static char Log[HOST_UART_OUT];
+  char want[64];
+  uint32_t i, n, p, len, logN = 0, cli = 0, got = 0, bad = 0;
+  uint32_t next[PRODUCERS] = {0};
+  uint32_t records, bytes;
+  Done = 0;
+  for(p = 0; p < PRODUCERS; p++){
+    xTaskCreate(prvProducer, "P", configMINIMAL_STACK_SIZE, (void *)(intptr_t)p, 2, NULL);
+  }
+  xTaskCreate(prvCli, "CLI", configMINIMAL_STACK_SIZE, NULL, 1, NULL);
+  CHECK(WaitFor(&Done, PRODUCERS + 1, 20000));
+  // the drain task must send everything that went in
+  CHECK(WaitFor(&Host_UartOutN, SentBytes + CLI_LINES*CLI_LINE, 20000));
+  usleep(50000);
+  CHECK(Host_UartOutN == SentBytes + CLI_LINES*CLI_LINE);
+  CHECK(FailedRecords < PRODUCERS*RECORDS);
+  vSerialLogGetDropped(&records, &bytes);
+  CHECK(records == 2 + FailedRecords);
+
+  // take the CLI out, it may have split a record, then walk the records
+  for(i = 0; i < Host_UartOutN && i < HOST_UART_OUT; i++){
+    if(Host_UartOut[i] == 'c'){
+      cli++;
+    }else{
+      Log[logN++] = (char)Host_UartOut[i];
+    }
+  }
+  CHECK(cli == CLI_LINES*CLI_LINE);
+  i = 0;
+  while(i < logN && !bad){
+    p = (uint32_t)(Log[i] - 'P');
+    if(p >= PRODUCERS){
+      bad = 1;
+      break;
+    }
+    for(n = next[p]; n < RECORDS && !Sent[p][n]; n++){}
+    len = (n < RECORDS) ? Record(want, p, n) : 0;
+    if(len == 0 || i + len > logN || memcmp(&Log[i], want, len)){
+      bad = 1;
+      break;
+    }
+    next[p] = n + 1;
+    i += len;
+    got++;
+  }
+  CHECK(!bad);
+  CHECK(i == logN);
+  CHECK(got == PRODUCERS*RECORDS - FailedRecords);
+}
+
+// The drain task is still running once everyone else has stopped
+static void test_after(void){
+  uint32_t n = Host_UartOutN;
+  CHECK(xSerialLogPrint("END\n") == pdPASS);
+  CHECK(WaitFor(&Host_UartOutN, n + 4, 2000));
+  CHECK(memcmp(&Host_UartOut[n], "END\n", 4) == 0);
+}
+
+int main(void){
+  alarm(60);                               // a drain task that never wakes
+  Host_Reset();
+  xSerialPortInitMinimal(0, 0);
+  Host_UartStart(1);
+  vSerialLogStart(1);
+  test_limits();
+  test_producers();
+  test_after();
+  Host_UartStop();
+  return Host_Result("test_serial_log");
+}
@@ -0,0 +1,200 @@
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// File:        test_wave.c
+// Function:    Compare-value stream of wave.c on the host
+//
+// wave.c runs unchanged on the register and DMA model.  The test plays
+// Timer A0 one PWM period at a time: CCR2 raises a request of DMA
+// channel 1 and the value that lands in CCR1 is recorded.  The DMA_INT2
+// handler runs a set number of periods after a buffer completes, to
+// model interrupt latency.  The stream must be WAVE_CCR of every sample
+// in order, padded with silence to a whole buffer, with no period left
+// without a new value before the end, and the handler must stop the
+// timer once the last buffer has played.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "msp.h"
+#include "driverlib.h"
+#include "hostModel.h"
+#include "wave.h"
+
+void vWave_Handler( void );
+
+#define WAVE_CHANNEL    1
+#define MAX_STREAM      (40*WAVE_HALF)
+
+static uint16_t Stream[MAX_STREAM];
+static uint32_t StreamN;
+static uint32_t Starved;        // periods that ran without a new value
+static uint32_t Gaps;           // of those, periods followed by more values
+static uint32_t Interrupts;
+static uint32_t ToneStops;
+
+// tone.c
+void tone_stop(void){ ToneStops++; }
+
+static int Running(void){
+  return (TIMER_A0->CTL&0x0030) == 0x0010;
+}
+
+// Run the timer until it stops or for at most max periods, the DMA
+// interrupt is serviced latency periods after it is raised
+static void Play(uint32_t max, uint32_t latency){
+  uint32_t pending = 0, wait = 0;
+  while(Running() && max--){
+    if(Host_DmaRequest(WAVE_CHANNEL)){
+      if(StreamN < MAX_STREAM) Stream[StreamN] = TIMER_A0->CCR[1];
+      StreamN++;
+      Gaps += Starved;
+      Starved = 0;
+    }else{
+      Starved++;
+    }
+    if((Host_DmaDone&(1u<<WAVE_CHANNEL)) && !pending){
+      pending = 1;
+      wait = latency;
+    }
+    if(pending){
+      if(wait){
+        wait--;
+      }else{
+        pending = 0;
+        Interrupts++;
+        vWave_Handler();
+      }
+    }
+  }
+}
+
+static void Start(void){
+  Host_Reset();
+  StreamN = Starved = Gaps = Interrupts = ToneStops = 0;
+  wave_init();
+}
+
+// Check the stream of a whole sound, then that the player has stopped
+static void CheckSound(const wave_t *w, uint32_t latency){
+  uint32_t i, padded = (w->length + WAVE_HALF - 1)/WAVE_HALF*WAVE_HALF;
+  CHECK(StreamN == padded);
+  for(i = 0; i < StreamN && i < MAX_STREAM; i++){
+    if(i < w->length){
+      CHECK(Stream[i] == WAVE_CCR(w->data[i]));
+    }else{
+      CHECK(Stream[i] == WAVE_CCR(128));
+    }
+  }
+  CHECK(Gaps == 0);
+  CHECK(Starved <= latency + 1);          // until the handler stops the timer
+  CHECK(Interrupts == padded/WAVE_HALF);  // once per buffer
+  CHECK(!Running());
+  CHECK(TIMER_A0->CCTL[1] == 0);          // output held low
+  CHECK(!DMA_isChannelEnabled(WAVE_CHANNEL));
+  CHECK(!wave_busy());
+}
+
+static uint8_t Data[20*WAVE_HALF + 37];
+
+static void MakeData(uint32_t seed){
+  uint32_t i;
+  srand(seed);
+  for(i = 0; i < sizeof(Data); i++) Data[i] = (uint8_t)rand();
+  Data[0] = 0;                            // both ends of the range
+  Data[1] = 255;
+}
+
+static void test_init(void){
+  Start();
+  CHECK(Host_Dma[WAVE_CHANNEL].mapping == DMA_CH1_TIMERA0CCR2);
+  CHECK(Host_Dma[WAVE_CHANNEL].ctl[0].control == (UDMA_SIZE_16|UDMA_SRC_INC_16|UDMA_DST_INC_NONE|UDMA_ARB_1));
+  CHECK(Host_Dma[WAVE_CHANNEL].ctl[1].control == Host_Dma[WAVE_CHANNEL].ctl[0].control);
+  CHECK(Host_IntEnabled & ((uint64_t)1<<INT_DMA_INT2));
+  CHECK(!wave_busy());
+}
+
+// Every sample maps inside the PWM period
+static void test_ccr(void){
+  uint32_t s;
+  for(s = 0; s < 256; s++){
+    CHECK(WAVE_CCR(s) <= WAVE_PWM_PERIOD - 4);
+  }
+  CHECK(WAVE_CCR(128) == WAVE_PWM_PERIOD/2);
+}
+
+// Lengths around the buffer size, with and without interrupt latency
+static void test_lengths(void){
+  static const uint32_t Length[] = {
+    1, 2, WAVE_HALF - 1, WAVE_HALF, WAVE_HALF + 1, 2*WAVE_HALF,
+    2*WAVE_HALF + 1, 3*WAVE_HALF, sizeof(Data)
+  };
+  static const uint32_t Latency[] = {0, 1, WAVE_HALF/2, WAVE_HALF - 1};
+  uint32_t i, j;
+  wave_t w;
+  MakeData(1);
+  for(i = 0; i < sizeof(Length)/sizeof(Length[0]); i++){
+    for(j = 0; j < sizeof(Latency)/sizeof(Latency[0]); j++){
+      Start();
+      w.data = Data;
+      w.length = Length[i];
+      wave_play(&w);
+      CHECK(ToneStops == 1);
+      CHECK(wave_busy());
+      CHECK(TIMER_A0->CCR[0] == WAVE_PWM_PERIOD - 1);
+      CHECK(TIMER_A0->CCTL[1] == 0x00E0);
+      CHECK((P2->SEL0&0x10) && (P2->DIR&0x10));
+      Play(MAX_STREAM + 2*WAVE_HALF, Latency[j]);
+      CheckSound(&w, Latency[j]);
+    }
+  }
+}
+
+// An empty sound does not start the timer
+static void test_empty(void){
+  wave_t w = {Data, 0};
+  Start();
+  wave_play(&w);
+  CHECK(!wave_busy());
+  CHECK(!Running());
+}
+
+// A new sound started part way through replaces the old one at once
+static void test_restart(void){
+  wave_t a = {Data, 5*WAVE_HALF}, b = {Data + 1000, 3*WAVE_HALF + 17};
+  MakeData(2);
+  Start();
+  wave_play(&a);
+  Play(2*WAVE_HALF + 40, 3);
+  CHECK(wave_busy());
+  StreamN = Starved = Gaps = Interrupts = 0;
+  wave_play(&b);
+  Play(MAX_STREAM, 3);
+  CheckSound(&b, 3);
+}
+
+static void test_stop(void){
+  wave_t w = {Data, 8*WAVE_HALF};
+  Start();
+  wave_play(&w);
+  Play(WAVE_HALF + 10, 0);
+  wave_stop();
+  CHECK(!wave_busy());
+  CHECK(!Running());
+  CHECK(!DMA_isChannelEnabled(WAVE_CHANNEL));
+  CHECK(TIMER_A0->CCTL[1] == 0);
+  // tone.c starts a note, then the interrupt of the last buffer comes in
+  TIMER_A0->CTL = 0x02C0 | 0x0010;
+  TIMER_A0->CCTL[1] = 0x0080;
+  vWave_Handler();
+  CHECK(Running());
+  CHECK(TIMER_A0->CCTL[1] == 0x0080);
+}
+
+int main(void){
+  test_init();
+  test_ccr();
+  test_lengths();
+  test_empty();
+  test_restart();
+  test_stop();
+  return Host_Result("test_wave");
+}
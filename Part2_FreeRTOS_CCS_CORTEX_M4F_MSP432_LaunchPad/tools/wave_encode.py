@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+# Author:      Mohd A. Zainol
+# Date:        16 Oct 2026
+# File:        wave_encode.py
+# Function:    Convert a WAV file into a wave_t for wave.c
+#
+# Usage: python3 wave_encode.py sound.wav name [rate] > name.c
+#
+# The WAV file can be 8 or 16-bit PCM, mono or stereo, any rate.  It is
+# mixed to mono, resampled to the player rate (SMCLK/WAVE_PWM_PERIOD,
+# 11719 Hz for SMCLK = 12 MHz) and written as unsigned 8-bit samples,
+# 128 is silence.  The player turns each sample s into the TA0 CCR1
+# value s*(WAVE_PWM_PERIOD/256), see WAVE_CCR in wave.h.
+
+import sys
+import wave
+
+SMCLK = 12000000
+WAVE_PWM_PERIOD = 1024
+
+
+def read_mono(path):
+    """Samples of the file as floats from -1 to 1, and the rate"""
+    with wave.open(path, 'rb') as w:
+        channels = w.getnchannels()
+        width = w.getsampwidth()
+        rate = w.getframerate()
+        raw = w.readframes(w.getnframes())
+    if width == 1:
+        values = [(b - 128)/128.0 for b in raw]
+    elif width == 2:
+        values = [int.from_bytes(raw[i:i+2], 'little', signed=True)/32768.0
+                  for i in range(0, len(raw), 2)]
+    else:
+        sys.exit('only 8 and 16-bit PCM is supported')
+    mono = [sum(values[i:i+channels])/channels
+            for i in range(0, len(values), channels)]
+    return mono, rate
+
+
+def resample(samples, rate_in, rate_out):
+    """Linear interpolation to the new rate"""
+    n = int(len(samples)*rate_out/rate_in)
+    out = []
+    for i in range(n):
+        pos = i*rate_in/rate_out
+        j = int(pos)
+        frac = pos - j
+        a = samples[j]
+        b = samples[j+1] if j+1 < len(samples) else a
+        out.append(a + (b - a)*frac)
+    return out
+
+
+def encode(samples):
+    """Floats from -1 to 1 to unsigned 8-bit"""
+    return [max(0, min(255, int(round(s*127.0)) + 128)) for s in samples]
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit('usage: wave_encode.py sound.wav name [rate] > name.c')
+    path, name = sys.argv[1], sys.argv[2]
+    rate = int(sys.argv[3]) if len(sys.argv) > 3 else SMCLK//WAVE_PWM_PERIOD
+    samples, rate_in = read_mono(path)
+    data = encode(resample(samples, rate_in, rate))
+    print('// Generated by tools/wave_encode.py from %s, %d Hz' % (path, rate))
+    print('#include <stdint.h>')
+    print('#include "wave.h"')
+    print()
+    print('static const uint8_t %s_data[%d] = {' % (name, len(data)))
+    for i in range(0, len(data), 16):
+        print('    ' + ','.join('%3d' % v for v in data[i:i+16]) + ',')
+    print('};')
+    print()
+    print('const wave_t %s = { %s_data, %d };' % (name, name, len(data)))
+
+
+if __name__ == '__main__':
+    main()
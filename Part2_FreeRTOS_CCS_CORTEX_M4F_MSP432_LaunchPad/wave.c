@@ -0,0 +1,180 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Buzzer connected to P2.4/TA0.1
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        wave.c
+// Function:    Wavetable sounds played through the buzzer by DMA
+
+// Timer A0 makes a PWM on P2.4 (CCR1, reset/set) with a period of
+// WAVE_PWM_PERIOD.  Once per period CCR2 requests DMA channel 1, which
+// copies the next compare value from RAM into CCR1.  The channel runs
+// in ping-pong mode over two buffers: while one plays, the completion
+// interrupt of the other converts the next WAVE_HALF samples from flash.
+// The CPU only runs once every WAVE_HALF samples (about 11ms).
+
+#include <stdint.h>
+#include "msp.h"
+#include "FreeRTOS.h"
+#include "dmaTable.h"
+#include "tone.h"
+#include "wave.h"
+
+#define WAVE_CHANNEL        1
+#define WAVE_SILENCE        128
+
+void vWave_Handler( void );
+
+static uint16_t usBufA[WAVE_HALF];  // primary structure
+static uint16_t usBufB[WAVE_HALF];  // alternate structure
+static const wave_t *pxWave;
+static volatile uint32_t ulPos;     // next sample to convert
+static volatile uint8_t ucArmed;    // number of buffers queued in the DMA
+
+// Convert the next samples into a buffer, returns 0 if none were left
+static int wave_fill(uint16_t *buf){
+    uint32_t i, n;
+    const uint8_t *src;
+    if(ulPos >= pxWave->length) return 0;
+    n = pxWave->length - ulPos;
+    if(n > WAVE_HALF) n = WAVE_HALF;
+    src = &pxWave->data[ulPos];
+    for(i = 0; i < n; i++){
+        buf[i] = WAVE_CCR(src[i]);
+    }
+    for(; i < WAVE_HALF; i++){
+        buf[i] = WAVE_CCR(WAVE_SILENCE);  // pad the last buffer
+    }
+    ulPos += n;
+    return 1;
+}
+
+// Arm one of the two control structures
+static void wave_arm(uint32_t select, uint16_t *buf){
+    MAP_DMA_setChannelTransfer(select | WAVE_CHANNEL, UDMA_MODE_PINGPONG,
+            buf, (void *)&TIMER_A0->CCR[1], WAVE_HALF);
+}
+
+void wave_init(void){
+    dmaTable_init();
+    MAP_DMA_assignChannel(DMA_CH1_TIMERA0CCR2);
+    MAP_DMA_disableChannelAttribute(WAVE_CHANNEL, UDMA_ATTR_ALTSELECT |
+            UDMA_ATTR_USEBURST | UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+    MAP_DMA_setChannelControl(UDMA_PRI_SELECT | WAVE_CHANNEL,
+            UDMA_SIZE_16 | UDMA_SRC_INC_16 | UDMA_DST_INC_NONE | UDMA_ARB_1);
+    MAP_DMA_setChannelControl(UDMA_ALT_SELECT | WAVE_CHANNEL,
+            UDMA_SIZE_16 | UDMA_SRC_INC_16 | UDMA_DST_INC_NONE | UDMA_ARB_1);
+    MAP_DMA_assignInterrupt(DMA_INT2, WAVE_CHANNEL);
+    MAP_Interrupt_setPriority(INT_DMA_INT2, configKERNEL_INTERRUPT_PRIORITY);
+    MAP_Interrupt_enableInterrupt(INT_DMA_INT2);
+    ucArmed = 0;
+}
+
+void wave_play(const wave_t *wave){
+    tone_stop();                        // the tone generator also uses Timer A0
+    wave_stop();
+    pxWave = wave;
+    ulPos = 0;
+    ucArmed = 0;
+    MAP_DMA_disableChannelAttribute(WAVE_CHANNEL, UDMA_ATTR_ALTSELECT);  // start on the primary
+    if(wave_fill(usBufA)){
+        wave_arm(UDMA_PRI_SELECT, usBufA);
+        ucArmed++;
+    }
+    if(wave_fill(usBufB)){
+        wave_arm(UDMA_ALT_SELECT, usBufB);
+        ucArmed++;
+    }else{
+        // short sound, the channel must stop after the primary
+        MAP_DMA_setChannelTransfer(UDMA_ALT_SELECT | WAVE_CHANNEL, UDMA_MODE_STOP,
+                usBufB, (void *)&TIMER_A0->CCR[1], 1);
+    }
+    if(ucArmed == 0) return;
+    P2->SEL0 |= 0x10;
+    P2->SEL1 &= ~0x10;                  // configure P2.4 as TA0.1
+    P2->DIR |= 0x10;                    // make P2.4 out
+    TIMER_A0->CTL = 0x0200;             // SMCLK, divide by 1, halted
+    TIMER_A0->EX0 = 0x0000;             // input divider /1
+    TIMER_A0->CCR[0] = WAVE_PWM_PERIOD - 1;
+    TIMER_A0->CCR[1] = WAVE_CCR(WAVE_SILENCE);
+    TIMER_A0->CCR[2] = 0;               // DMA request at the start of each period
+    TIMER_A0->CCTL[1] = 0x00E0;         // reset/set
+    TIMER_A0->CCTL[2] = 0x0000;         // compare, no interrupt
+    MAP_DMA_enableChannel(WAVE_CHANNEL);
+    TIMER_A0->CTL |= 0x0014;            // reset and start in up mode
+}
+
+void wave_stop(void){
+    // cleared first, so a DMA interrupt from here on does not stop
+    // Timer A0 again once tone.c has started a note on it
+    ucArmed = 0;
+    MAP_DMA_disableChannel(WAVE_CHANNEL);
+    TIMER_A0->CTL &= ~0x0030;           // halt Timer A0
+    TIMER_A0->CCTL[1] = 0x0000;         // OUT mode, output low
+}
+
+int wave_busy(void){
+    return ucArmed != 0;
+}
+
+// A buffer finished playing, the DMA has moved on to the other one
+void vWave_Handler( void )
+{
+    MAP_DMA_clearInterruptFlag(WAVE_CHANNEL);
+    if(ucArmed == 0) return;
+    if(MAP_DMA_getChannelMode(UDMA_PRI_SELECT | WAVE_CHANNEL) == UDMA_MODE_STOP){
+        if(wave_fill(usBufA)){
+            wave_arm(UDMA_PRI_SELECT, usBufA);
+        }else{
+            ucArmed--;
+        }
+    }else if(MAP_DMA_getChannelMode(UDMA_ALT_SELECT | WAVE_CHANNEL) == UDMA_MODE_STOP){
+        if(wave_fill(usBufB)){
+            wave_arm(UDMA_ALT_SELECT, usBufB);
+        }else{
+            ucArmed--;
+        }
+    }
+    if(ucArmed == 0){
+        wave_stop();                    // the last buffer has played
+    }
+}
@@ -0,0 +1,113 @@
+/*
+  This code accompanies the books
+   "Embedded Systems: Introduction to the MSP432 Microcontroller",
+       ISBN: 978-1512185676, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Interfacing to the MSP432 Microcontroller",
+       ISBN: 978-1514676585, Jonathan Valvano, copyright (c) 2017
+   "Embedded Systems: Real-Time Operating Systems for ARM Cortex-M Microcontrollers",
+       ISBN: 978-1466468863, , Jonathan Valvano, copyright (c) 2017
+ For more information about my classes, my research, and my books, see
+ http://users.ece.utexas.edu/~valvano/
+
+Simplified BSD License (FreeBSD License)
+Copyright (c) 2017, Jonathan Valvano, All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are
+those of the authors and should not be interpreted as representing official
+policies, either expressed or implied, of the FreeBSD Project.
+*/
+
+// Author:      Mohd A. Zainol
+// Date:        16 Oct 2026
+// Chip:        MSP432P401R LaunchPad Development Kit (MSP-EXP432P401R) for TI-RSLK
+// File:        wave.h
+// Function:    header file of wave.c
+
+#ifndef WAVE_H_
+#define WAVE_H_
+
+#include <stdint.h>
+
+// The buzzer is driven by a PWM of WAVE_PWM_PERIOD SMCLK cycles, one
+// sample per PWM period, so the sample rate is SMCLK/WAVE_PWM_PERIOD
+// (11719 Hz with SMCLK = 12 MHz).  tools/wave_encode.py makes the data
+#define WAVE_PWM_PERIOD     1024
+// Samples moved by DMA between two refills, at most 1024
+#define WAVE_HALF           128
+
+// A sound in flash, unsigned 8-bit samples, 128 is silence
+typedef struct {
+    const uint8_t *data;
+    uint32_t length;        // number of samples
+} wave_t;
+
+/**
+ * Set up DMA channel 1 (TA0 CCR2 trigger) and its interrupt
+ *
+ * @param  none
+ * @return none
+ * @note   Shares Timer A0 and the buzzer on P2.4 with tone.c, call
+ *         tone_init first if both are used
+ * @brief  Initialize the wavetable player
+ */
+void wave_init(void);
+
+/**
+ * Play a sound in the background
+ *
+ * @param  wave is the sound, it must stay valid while playing
+ * @return none
+ * @note   Returns right away, stops any tone or sound playing.
+ *         Call from a task, not from an ISR
+ * @brief  Start wavetable playback
+ */
+void wave_play(const wave_t *wave);
+
+/**
+ * Stop the sound and silence the buzzer
+ *
+ * @param  none
+ * @return none
+ * @brief  Stop wavetable playback
+ */
+void wave_stop(void);
+
+/**
+ * Check whether a sound is playing
+ *
+ * @param  none
+ * @return 1 while playing, 0 when silent
+ * @brief  Wave busy flag
+ */
+int wave_busy(void);
+
+/**
+ * Compare value the player writes for one sample
+ *
+ * @param  sample is an unsigned 8-bit sample
+ * @return TA0 CCR1 value, 0 to WAVE_PWM_PERIOD-4
+ * @brief  Sample to PWM compare value
+ */
+#define WAVE_CCR(sample)    ((uint16_t)((sample)*(WAVE_PWM_PERIOD/256)))
+
+#endif